@@ -28,6 +28,8 @@ static OS_TCB AppTaskStartTCB;
 static void AppTaskStart(void *p_arg);
 static void AppTaskCreate(void);
 
+extern CPU_INT32U SystemCoreClock;                  /*CMSIS:CPU主频*/
+
 /*空函数*/
 #define BSP_Init()          do{ rt_kprintf("BSP init!\r\n"); }while(0)
 #define BSP_LED_Toggle(x)   do{ rt_kprintf("LED Toggle!\r\n"); }while(0)
@@ -71,6 +73,7 @@ static void AppTaskStart(void *p_arg)
 
     BSP_Init();
     CPU_Init();
+    CPU_TS_TmrFreqSet((CPU_TS_TMR_FREQ)SystemCoreClock);/*DWT周期计数器的频率即CPU主频*/
 
 #if OS_CFG_APP_HOOKS_EN > 0u
     App_OS_SetAllHooks();                           /*设置钩子函数*/
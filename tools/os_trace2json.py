@@ -0,0 +1,221 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+#
+# Copyright (c) 2021, Meco Jianting Man <jiantingman@foxmail.com>
+#
+# SPDX-License-Identifier: Apache-2.0
+#
+# Change Logs:
+# Date           Author       Notes
+# 2026-10-19     agent        first version
+#
+"""
+将uCOS-III兼容层跟踪记录器(OS_CFG_TRACE_EN)导出的缓冲区转换为Chrome/Perfetto可以打开的JSON文件
+(chrome://tracing 或 https://ui.perfetto.dev).
+
+两种输入格式:
+
+  1. msh命令'ucos -trace'的文本输出(串口日志中可以夹杂其他内容):
+
+         python os_trace2json.py uart.log -o trace.json
+
+  2. 调试器直接转储的OSCfg_TraceBuf[]内存(小端,每条记录20字节),需要给出转储时OSTraceIx的值以及
+     时间戳频率:
+
+         python os_trace2json.py --bin buf.bin --ix 37 --freq 168000000 -o trace.json
+
+输出中CPU轨道显示各线程的运行区间,ISR轨道显示中断,每个线程一条轨道显示其发布/等待操作.
+发布与随后成功返回的等待之间以箭头(flow)相连,可以直接看到"中断 -> OSQPost -> OSQPend唤醒"的延迟链.
+开启中断延迟发布时,中断处理任务的重新发布记录(带EV_REPOST标志)并入对应的中断发布,箭头仍从中断发出.
+"""
+
+import argparse
+import collections
+import json
+import struct
+import sys
+
+EV_NONE = 0
+EV_NAME = 1
+EV_TASK_SW = 2
+EV_ISR_ENTER = 3
+EV_ISR_EXIT = 4
+EV_TIME_DLY = 5
+EV_TIME_DLY_EXIT = 6
+EV_TMR_EXPIRE = 7
+EV_REPOST = 0x8000                              # 标志位: 中断处理任务代为完成的延迟发布
+
+# 与os.h中OS_TRACE_EV_xxx保持一致: (POST, PEND, PEND_EXIT)
+OBJ_EVENTS = {
+    16: ('OSSemPost', 'post'), 17: ('OSSemPend', 'pend'), 18: ('OSSemPend', 'exit'),
+    19: ('OSMutexPost', 'post'), 20: ('OSMutexPend', 'pend'), 21: ('OSMutexPend', 'exit'),
+    22: ('OSQPost', 'post'), 23: ('OSQPend', 'pend'), 24: ('OSQPend', 'exit'),
+    25: ('OSFlagPost', 'post'), 26: ('OSFlagPend', 'pend'), 27: ('OSFlagPend', 'exit'),
+}
+
+REC_FMT = '<IHHIII'
+REC_SIZE = struct.calcsize(REC_FMT)
+
+TID_CPU = 0
+TID_ISR = 1
+
+
+def parse_text(lines):
+    """解析'ucos -trace'的输出, 返回(freq, records)"""
+    freq = 0
+    recs = []
+    inside = False
+    for line in lines:
+        line = line.strip()
+        if line.startswith('OSTRACE END'):
+            inside = False
+            continue
+        if line.startswith('OSTRACE '):
+            fields = line.split()
+            freq = int(fields[4])
+            recs = []                               # 以最后一次导出为准
+            inside = True
+            continue
+        if inside and line.startswith('R '):
+            f = line.split()
+            recs.append((int(f[1], 16), int(f[2]), int(f[3]),
+                         int(f[4], 16), int(f[5], 16), int(f[6], 16)))
+    return freq, recs
+
+
+def parse_bin(data, ix):
+    """解析OSCfg_TraceBuf[]的内存转储, 从最旧的记录(下标ix)开始"""
+    nbr = len(data) // REC_SIZE
+    recs = []
+    for i in range(nbr):
+        off = ((ix + i) % nbr) * REC_SIZE
+        rec = struct.unpack_from(REC_FMT, data, off)
+        if rec[1] != EV_NONE:
+            recs.append(rec)
+    return recs
+
+
+def name_of(names, addr):
+    return names.get(addr, '0x%08x' % addr)
+
+
+def convert(recs, freq):
+    if freq == 0:
+        sys.stderr.write('warning: unknown timestamp frequency, assuming 1 MHz\n')
+        freq = 1000000
+
+    names = {}
+    for ts, ev, nest, task, obj, arg in recs:  # 先收集名称, 使记录名称之前的事件也能显示名称
+        if ev == EV_NAME:
+            raw = struct.pack('<II', task, arg).split(b'\0')[0]
+            names[obj] = raw.decode('ascii', 'replace')
+
+    out = []
+    threads = set()
+    running = None                              # CPU轨道上当前运行的线程
+    last_post = {}                              # obj -> (us, tid, flow id, 实际生效的时间)
+    deferred = collections.defaultdict(collections.deque)  # obj -> 尚未被重新发布的中断发布
+    pend_start = {}                             # (tid, obj) -> us
+    flow_id = 0
+    acc = 0
+    prev = None
+
+    for ts, ev, nest, task, obj, arg in recs:
+        if prev is not None:
+            acc += (ts - prev) & 0xFFFFFFFF     # 32位时间戳回绕
+        prev = ts
+        if ev == EV_NAME:
+            continue
+        repost = (ev & EV_REPOST) != 0
+        ev &= ~EV_REPOST
+        us = acc * 1e6 / freq
+        tid = TID_ISR if nest > 0 else task
+        if tid != TID_ISR:
+            threads.add(tid)
+
+        if ev == EV_TASK_SW:
+            if running is not None:
+                out.append({'ph': 'E', 'pid': 0, 'tid': TID_CPU, 'ts': us})
+            running = obj
+            threads.add(obj)
+            out.append({'ph': 'B', 'pid': 0, 'tid': TID_CPU, 'ts': us, 'name': name_of(names, obj)})
+        elif ev == EV_ISR_ENTER:
+            out.append({'ph': 'B', 'pid': 0, 'tid': TID_ISR, 'ts': us, 'name': 'ISR'})
+        elif ev == EV_ISR_EXIT:
+            out.append({'ph': 'E', 'pid': 0, 'tid': TID_ISR, 'ts': us})
+        elif ev == EV_TIME_DLY:
+            out.append({'ph': 'B', 'pid': 0, 'tid': tid, 'ts': us, 'name': 'OSTimeDly',
+                        'args': {'dly': arg}})
+        elif ev == EV_TIME_DLY_EXIT:
+            out.append({'ph': 'E', 'pid': 0, 'tid': tid, 'ts': us, 'args': {'err': arg}})
+        elif ev == EV_TMR_EXPIRE:
+            out.append({'ph': 'X', 'pid': 0, 'tid': tid, 'ts': us, 'dur': 0,
+                        'name': 'Tmr(%s)' % name_of(names, obj)})
+        elif ev in OBJ_EVENTS:
+            api, kind = OBJ_EVENTS[ev]
+            label = '%s(%s)' % (api, name_of(names, obj))
+            if kind == 'post' and repost and deferred[obj]:
+                isr = deferred[obj].popleft()      # 按先进先出与中断中的发布对应
+                last_post[obj] = (isr[0], isr[1], isr[2], us)
+                out.append({'ph': 'X', 'pid': 0, 'tid': tid, 'ts': us, 'dur': 0, 'name': label + ' [re-post]',
+                            'args': {'arg': arg}})
+            elif kind == 'post':
+                flow_id += 1
+                last_post[obj] = (us, tid, flow_id, us)
+                if nest > 0:
+                    deferred[obj].append(last_post[obj])
+                out.append({'ph': 'X', 'pid': 0, 'tid': tid, 'ts': us, 'dur': 0, 'name': label,
+                            'args': {'arg': arg}})
+            elif kind == 'pend':
+                pend_start[(tid, obj)] = us
+                out.append({'ph': 'B', 'pid': 0, 'tid': tid, 'ts': us, 'name': label,
+                            'args': {'timeout': arg}})
+            else:
+                out.append({'ph': 'E', 'pid': 0, 'tid': tid, 'ts': us, 'args': {'err': arg}})
+                start = pend_start.pop((tid, obj), None)
+                post = last_post.get(obj)
+                if arg == 0 and post is not None and (start is None or post[3] >= start):
+                    out.append({'ph': 's', 'pid': 0, 'tid': post[1], 'ts': post[0], 'id': post[2],
+                                'name': 'wake', 'cat': 'wake'})
+                    out.append({'ph': 'f', 'pid': 0, 'tid': tid, 'ts': us, 'id': post[2],
+                                'name': 'wake', 'cat': 'wake', 'bp': 'e'})
+                    del last_post[obj]
+
+    if running is not None:
+        out.append({'ph': 'E', 'pid': 0, 'tid': TID_CPU, 'ts': acc * 1e6 / freq})
+
+    meta = [{'ph': 'M', 'pid': 0, 'name': 'process_name', 'args': {'name': 'uCOS-III'}},
+            {'ph': 'M', 'pid': 0, 'tid': TID_CPU, 'name': 'thread_name', 'args': {'name': 'CPU'}},
+            {'ph': 'M', 'pid': 0, 'tid': TID_ISR, 'name': 'thread_name', 'args': {'name': 'ISR'}}]
+    for t in sorted(threads):
+        meta.append({'ph': 'M', 'pid': 0, 'tid': t, 'name': 'thread_name',
+                     'args': {'name': name_of(names, t)}})
+    return {'traceEvents': meta + out, 'displayTimeUnit': 'ns'}
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Convert a uCOS-III wrapper trace dump to Chrome/Perfetto JSON')
+    parser.add_argument('input', help="text output of 'ucos -trace', or a raw OSCfg_TraceBuf[] dump with --bin")
+    parser.add_argument('-o', '--output', default='trace.json', help='output JSON file (default: trace.json)')
+    parser.add_argument('--bin', action='store_true', help='input is a raw memory dump of OSCfg_TraceBuf[]')
+    parser.add_argument('--ix', type=int, default=0, help='value of OSTraceIx when the raw dump was taken')
+    parser.add_argument('--freq', type=int, default=None, help='timestamp frequency in Hz (overrides the dump)')
+    args = parser.parse_args()
+
+    if args.bin:
+        with open(args.input, 'rb') as f:
+            recs = parse_bin(f.read(), args.ix)
+        freq = 0
+    else:
+        with open(args.input, 'r', errors='replace') as f:
+            freq, recs = parse_text(f)
+    if args.freq is not None:
+        freq = args.freq
+
+    with open(args.output, 'w') as f:
+        json.dump(convert(recs, freq), f)
+    print('%d records -> %s' % (len(recs), args.output))
+
+
+if __name__ == '__main__':
+    main()
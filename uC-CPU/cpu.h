@@ -82,6 +82,7 @@ extern  "C" {
 
 #include <rtdef.h>
 #include "cpu_def.h"
+#include "cpu_cfg.h"
 #include <rtconfig.h>
 
 /*
@@ -229,9 +230,23 @@ typedef  rt_ubase_t                 CPU_SR;                     /* Defines   CPU
 #define  CPU_INT_EN()          do { CPU_SR_Restore(cpu_sr); } while (0) /* Restore CPU status word.                     */
 
 
+#ifdef   CPU_CFG_INT_DIS_MEAS_EN
+                                                                        /* Disable interrupts, ...                      */
+                                                                        /* & start interrupts disabled time measurement.*/
+#define  CPU_CRITICAL_ENTER()  do { CPU_INT_DIS(); \
+                                    CPU_IntDisMeasStart((const CPU_CHAR *)__FILE__, (CPU_INT32U)__LINE__); } while (0)
+                                                                        /* Stop & measure   interrupts disabled time,   */
+                                                                        /* ...  & re-enable interrupts.                 */
+#define  CPU_CRITICAL_EXIT()   do { CPU_IntDisMeasStop(); \
+                                    CPU_INT_EN();          } while (0)
+
+#else
+
 #define  CPU_CRITICAL_ENTER()  do { CPU_INT_DIS(); } while (0)          /* Disable   interrupts.                        */
 #define  CPU_CRITICAL_EXIT()   do { CPU_INT_EN();  } while (0)          /* Re-enable interrupts.                        */
 
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -242,6 +257,13 @@ typedef  rt_ubase_t                 CPU_SR;                     /* Defines   CPU
 CPU_SR      CPU_SR_Save      (void);
 void        CPU_SR_Restore   (CPU_SR      cpu_sr);
 
+#ifdef  CPU_CFG_INT_DIS_MEAS_EN                                 /* Called by CPU_CRITICAL_ENTER()/CPU_CRITICAL_EXIT().  */
+void        CPU_IntDisMeasStart(const CPU_CHAR   *p_file,
+                                      CPU_INT32U  line);
+
+void        CPU_IntDisMeasStop (void);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
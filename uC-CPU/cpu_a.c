@@ -50,7 +50,30 @@
 */
 
 #include "cpu.h"
+#include "cpu_core.h"
 #include <rthw.h>
+#include <rtthread.h>
+
+#if (CPU_CFG_TS_TMR_EN == DEF_ENABLED)
+#if defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__) || defined(__ARM_ARCH_8M_MAIN__) || \
+    defined(__TARGET_ARCH_7_M) || defined(__TARGET_ARCH_7E_M)
+#define  CPU_TS_TMR_DWT                                         /* Cortex-M3/M4/M7/M33: DWT周期计数器                   */
+#elif defined(__linux__) || defined(__APPLE__)
+#define  CPU_TS_TMR_HOST                                        /* 主机模拟器: clock_gettime()                          */
+#include <time.h>
+#endif
+#endif
+
+#ifdef CPU_TS_TMR_DWT
+#define  CPU_REG_DEM_CR                       (*(CPU_REG32 *)0xE000EDFC)
+#define  CPU_REG_DWT_CR                       (*(CPU_REG32 *)0xE0001000)
+#define  CPU_REG_DWT_CYCCNT                   (*(CPU_REG32 *)0xE0001004)
+#define  CPU_REG_DWT_LAR                      (*(CPU_REG32 *)0xE0001FB0)
+
+#define  CPU_BIT_DEM_CR_TRCENA                    DEF_BIT_24
+#define  CPU_BIT_DWT_CR_CYCCNTENA                 DEF_BIT_00
+#define  CPU_DWT_LAR_KEY                          0xC5ACCE55u   /* Cortex-M7需解锁DWT寄存器                             */
+#endif
 
 /*
 ;********************************************************************************************************
@@ -89,3 +112,54 @@ void CPU_SR_Restore (CPU_SR cpu_sr)
 {
     rt_hw_interrupt_enable(cpu_sr);
 }
+
+/*
+;********************************************************************************************************
+;                                       TIMESTAMP TIMER FUNCTIONS
+;
+; Description : CPU_TS_TmrInit() initializes & starts the CPU timestamp timer; CPU_TS_TmrRd() returns its
+;               current 32-bit up-counting value.
+;
+; Prototypes  : void        CPU_TS_TmrInit(void);
+;               CPU_TS_TMR  CPU_TS_TmrRd  (void);
+;
+; Note(s)     : (1) Cortex-M3/M4/M7/M33使用DWT周期计数器,频率为CPU主频,需由应用调用CPU_TS_TmrFreqSet()设置.
+;
+;               (2) 主机(Linux/macOS)模拟器使用clock_gettime(CLOCK_MONOTONIC),单位为纳秒.
+;
+;               (3) 其他平台退化为RT-Thread系统节拍,精度为1个OS Tick.
+;
+;               (4) 以上均为弱定义,BSP可提供更合适的实现.
+;
+;               (5) OSInit()与CPU_Init()都会调用CPU_TS_TmrInit(),因此该函数可重复调用且不复位计数值.
+;********************************************************************************************************
+*/
+
+#if (CPU_CFG_TS_TMR_EN == DEF_ENABLED)
+RT_WEAK void CPU_TS_TmrInit (void)
+{
+#if defined(CPU_TS_TMR_DWT)
+    CPU_REG_DEM_CR     |= (CPU_INT32U)CPU_BIT_DEM_CR_TRCENA;    /* Enable Cortex-M DWT unit                             */
+    CPU_REG_DWT_LAR     = (CPU_INT32U)CPU_DWT_LAR_KEY;
+    CPU_REG_DWT_CR     |= (CPU_INT32U)CPU_BIT_DWT_CR_CYCCNTENA; /* Enable Cortex-M cycle counter                        */
+#elif defined(CPU_TS_TMR_HOST)
+    CPU_TS_TmrFreqSet((CPU_TS_TMR_FREQ)1000000000u);
+#else
+    CPU_TS_TmrFreqSet((CPU_TS_TMR_FREQ)RT_TICK_PER_SECOND);
+#endif
+}
+
+RT_WEAK CPU_TS_TMR CPU_TS_TmrRd (void)
+{
+#if defined(CPU_TS_TMR_DWT)
+    return ((CPU_TS_TMR)CPU_REG_DWT_CYCCNT);
+#elif defined(CPU_TS_TMR_HOST)
+    struct timespec  ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((CPU_TS_TMR)((CPU_INT64U)ts.tv_sec * 1000000000u + (CPU_INT64U)ts.tv_nsec));
+#else
+    return ((CPU_TS_TMR)rt_tick_get());
+#endif
+}
+#endif
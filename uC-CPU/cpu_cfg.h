@@ -93,6 +93,65 @@
 #define  CPU_CFG_NAME_SIZE                                16    /* ... (see Note #2).                                   */
 
 
+/*
+*********************************************************************************************************
+*                                     CPU TIMESTAMP CONFIGURATION
+*
+* Note(s) : (1) Configure CPU_CFG_TS_xx_EN to enable/disable CPU timestamp features :
+*
+*               (a) CPU_CFG_TS_32_EN   enable/disable 32-bit CPU timestamp feature
+*               (b) CPU_CFG_TS_64_EN   enable/disable 64-bit CPU timestamp feature
+*
+*           (2) 时间戳定时器由cpu_a.c中的CPU_TS_TmrInit()/CPU_TS_TmrRd()提供:Cortex-M3/M4/M7/M33使用DWT
+*               周期计数器,主机(Linux/macOS)模拟器使用clock_gettime(),其余平台退化为RT-Thread系统节拍.
+*               这两个函数为弱定义,BSP可以重新实现.
+*
+*           (3) DWT周期计数器的频率即CPU主频,兼容层无法得知,需由应用调用CPU_TS_TmrFreqSet()设置.
+*********************************************************************************************************
+*/
+
+                                                                /* Configure CPU timestamp features (see Note #1) :     */
+#define  CPU_CFG_TS_32_EN                       DEF_ENABLED
+#define  CPU_CFG_TS_64_EN                       DEF_ENABLED
+                                                                /*   DEF_DISABLED  CPU timestamps DISABLED              */
+                                                                /*   DEF_ENABLED   CPU timestamps ENABLED               */
+
+
+/*
+*********************************************************************************************************
+*                        CPU INTERRUPTS DISABLED TIME MEASUREMENT CONFIGURATION
+*
+* Note(s) : (1) Configure CPU_CFG_INT_DIS_MEAS_EN to enable/disable measuring CPU's interrupts disabled
+*               time :
+*
+*               (a)  Enabled,       if CPU_CFG_INT_DIS_MEAS_EN      #define'd in 'cpu_cfg.h'
+*
+*               (b) Disabled,       if CPU_CFG_INT_DIS_MEAS_EN  NOT #define'd in 'cpu_cfg.h'
+*
+*               开启后CPU_CRITICAL_ENTER()/CPU_CRITICAL_EXIT()将记录每段临界区的关中断时间(单位为时间戳
+*               定时器计数值),统计最大值、直方图以及最大值发生的位置(源文件及行号).使用uCOS-III时,还会
+*               在任务切换时统计每个任务的关中断最大时间(OS_TCB.IntDisTimeMax).
+*
+*           (2) Configure CPU_CFG_INT_DIS_MEAS_OVRHD_NBR with the number of times to measure &
+*               average the interrupts disabled time measurements overhead.
+*
+*           (3) Configure CPU_CFG_INT_DIS_MEAS_HIST_SIZE with the number of histogram buckets. Bucket
+*               'n' counts interrupts disabled times in the range [2^n, 2^(n+1)) counts; the last
+*               bucket also counts all longer times.
+*********************************************************************************************************
+*/
+
+#if 0                                                           /* Configure CPU interrupts disabled time ...           */
+#define  CPU_CFG_INT_DIS_MEAS_EN                                /* ... measurements feature (see Note #1).              */
+#endif
+
+                                                                /* Configure number of interrupts disabled overhead ... */
+#define  CPU_CFG_INT_DIS_MEAS_OVRHD_NBR                    1u   /* ... time measurements (see Note #2).                 */
+
+                                                                /* Configure number of interrupts disabled time ...     */
+#define  CPU_CFG_INT_DIS_MEAS_HIST_SIZE                   16u   /* ... histogram buckets (see Note #3).                 */
+
+
 /*$PAGE*/
 /*
 *********************************************************************************************************
@@ -75,6 +75,14 @@
 static  void        CPU_NameInit         (void);
 #endif
 
+#if    (CPU_CFG_TS_TMR_EN == DEF_ENABLED)                           /* ----------------- CPU TS FNCTS ----------------- */
+static  void        CPU_TS_Init          (void);
+#endif
+
+#ifdef  CPU_CFG_INT_DIS_MEAS_EN                                     /* ---------- CPU INT DIS TIME MEAS FNCTS --------- */
+static  void        CPU_IntDisMeasInit   (void);
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -112,6 +120,14 @@ static  void        CPU_NameInit         (void);
 
 void  CPU_Init (void)
 {
+                                                                /* --------------------- INIT TS ---------------------- */
+#if (CPU_CFG_TS_TMR_EN == DEF_ENABLED)
+     CPU_TS_Init();                                             /* See Note #3a.                                        */
+#endif
+                                                                /* -------------- INIT INT DIS TIME MEAS -------------- */
+#ifdef  CPU_CFG_INT_DIS_MEAS_EN
+     CPU_IntDisMeasInit();                                      /* See Note #3b.                                        */
+#endif
                                                                 /* ------------------ INIT CPU NAME ------------------- */
 #if (CPU_CFG_NAME_EN == DEF_ENABLED)
      CPU_NameInit();
@@ -296,6 +312,517 @@ void  CPU_NameSet (const  CPU_CHAR  *p_name,
 #endif
 
 
+/*
+*********************************************************************************************************
+*                                           CPU_TS_Get32()
+*
+* Description : Get current 32-bit CPU timestamp.
+*
+* Argument(s) : none.
+*
+* Return(s)   : Current 32-bit CPU timestamp (in timestamp timer counts).
+*
+* Caller(s)   : Application.
+*
+*               This function is a CPU module application programming interface (API) function & MAY
+*               be called by application function(s).
+*
+* Note(s)     : (1) The timestamp timer is 32 bits wide, so the 32-bit CPU timestamp is the timer count
+*                   itself & wraps around every 2^32 timer counts.
+*********************************************************************************************************
+*/
+
+#if (CPU_CFG_TS_32_EN == DEF_ENABLED)
+CPU_TS32  CPU_TS_Get32 (void)
+{
+    return ((CPU_TS32)CPU_TS_TmrRd());
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                           CPU_TS_Get64()
+*
+* Description : Get current 64-bit CPU timestamp.
+*
+* Argument(s) : none.
+*
+* Return(s)   : Current 64-bit CPU timestamp (in timestamp timer counts).
+*
+* Caller(s)   : CPU_TS_Update(),
+*               Application.
+*
+*               This function is a CPU module application programming interface (API) function & MAY
+*               be called by application function(s).
+*
+* Note(s)     : (1) The 64-bit timestamp accumulates the timer deltas since the previous call.  Either
+*                   CPU_TS_Get64() or CPU_TS_Update() MUST be called at least once per timer overflow
+*                   period (see also 'CPU_TS_Update()  Note #1').
+*********************************************************************************************************
+*/
+
+#if (CPU_CFG_TS_64_EN == DEF_ENABLED)
+CPU_TS64  CPU_TS_Get64 (void)
+{
+    CPU_TS_TMR  tmr_cur;
+    CPU_TS_TMR  tmr_delta;
+    CPU_TS64    ts;
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    tmr_cur            = CPU_TS_TmrRd();                        /* Get cur ts tmr cnts.                                 */
+    tmr_delta          = tmr_cur - CPU_TS_64_TmrPrev;           /* Calc      delta ts tmr cnts.                         */
+    CPU_TS_64_Accum   += (CPU_TS64)tmr_delta;                   /* Inc ts by delta ts tmr cnts.                         */
+    CPU_TS_64_TmrPrev  = tmr_cur;                               /* Save cur ts tmr cnts for next update.                */
+    ts                 = CPU_TS_64_Accum;
+    CPU_CRITICAL_EXIT();
+
+    return (ts);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                           CPU_TS_Update()
+*
+* Description : Update current CPU timestamp(s).
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : OS_StatTask(),
+*               Application.
+*
+*               This function is a CPU module application programming interface (API) function & MAY
+*               be called by application function(s).
+*
+* Note(s)     : (1) The 64-bit timestamp MUST be updated at least once per timestamp timer overflow period
+*                   (e.g. every 25 s for a 168 MHz DWT cycle counter).  uC/OS-III兼容层的统计任务会周期性地
+*                   调用本函数.
+*********************************************************************************************************
+*/
+
+#if (CPU_CFG_TS_EN == DEF_ENABLED)
+void  CPU_TS_Update (void)
+{
+#if (CPU_CFG_TS_64_EN == DEF_ENABLED)
+   (void)CPU_TS_Get64();
+#endif
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                         CPU_TS_TmrFreqGet()
+*
+* Description : Get CPU timestamp's timer frequency.
+*
+* Argument(s) : p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               CPU_ERR_NONE                    CPU timestamp's timer frequency successfully
+*                                                                   returned.
+*                               CPU_ERR_TS_FREQ_INVALID         CPU timestamp's timer frequency invalid &/or
+*                                                                   NOT yet configured.
+*
+* Return(s)   : CPU timestamp's timer frequency (in Hertz), if NO error(s).
+*
+*               0,                                              otherwise.
+*
+* Caller(s)   : Application.
+*
+*               This function is a CPU module application programming interface (API) function & MAY be
+*               called by application function(s).
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+#if (CPU_CFG_TS_TMR_EN == DEF_ENABLED)
+CPU_TS_TMR_FREQ  CPU_TS_TmrFreqGet (CPU_ERR  *p_err)
+{
+    CPU_TS_TMR_FREQ  freq_hz;
+
+
+    if (p_err == (CPU_ERR *)0) {
+        CPU_SW_EXCEPTION(0);
+    }
+
+    freq_hz =  CPU_TS_TmrFreq_Hz;
+   *p_err   = (freq_hz != 0u) ? CPU_ERR_NONE : CPU_ERR_TS_FREQ_INVALID;
+
+    return (freq_hz);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                         CPU_TS_TmrFreqSet()
+*
+* Description : Set CPU timestamp's timer frequency.
+*
+* Argument(s) : freq_hz     Frequency (in Hertz) to set for CPU timestamp's timer.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : CPU_TS_TmrInit(),
+*               Application.
+*
+*               This function is a CPU module application programming interface (API) function & MAY be
+*               called by application function(s).
+*
+* Note(s)     : (1) DWT周期计数器的频率即CPU主频,需由应用在CPU_Init()之后设置,例如:
+*
+*                       CPU_TS_TmrFreqSet((CPU_TS_TMR_FREQ)SystemCoreClock);
+*********************************************************************************************************
+*/
+
+#if (CPU_CFG_TS_TMR_EN == DEF_ENABLED)
+void  CPU_TS_TmrFreqSet (CPU_TS_TMR_FREQ  freq_hz)
+{
+    CPU_TS_TmrFreq_Hz = freq_hz;
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                        CPU_IntDisMeasStart()
+*
+* Description : Start interrupts disabled time measurement.
+*
+* Argument(s) : p_file      Pointer to source file name of the critical section.
+*
+*               line        Source line number      of the critical section.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : CPU_CRITICAL_ENTER().
+*
+*               This function is an INTERNAL CPU module function & MUST NOT be called by application
+*               function(s).
+*
+* Note(s)     : (1) Interrupts MUST be disabled when this function is called.
+*
+*               (2) 仅在最外层临界区开始计时,嵌套的临界区只增加嵌套计数.
+*********************************************************************************************************
+*/
+
+#ifdef  CPU_CFG_INT_DIS_MEAS_EN
+void  CPU_IntDisMeasStart (const  CPU_CHAR    *p_file,
+                                  CPU_INT32U   line)
+{
+    CPU_IntDisMeasCtr++;
+    if (CPU_IntDisNestCtr == 0u) {                              /* If ints NOT yet dis'd, ...                           */
+        CPU_IntDisMeasStartFile  = p_file;                      /* ... save call site & ...                             */
+        CPU_IntDisMeasStartLine  = line;
+        CPU_IntDisMeasStart_cnts = CPU_TS_TmrRd();              /* ... save ints dis'd start time.                      */
+    }
+    CPU_IntDisNestCtr++;
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                        CPU_IntDisMeasStop()
+*
+* Description : Stop interrupts disabled time measurement.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : CPU_CRITICAL_EXIT().
+*
+*               This function is an INTERNAL CPU module function & MUST NOT be called by application
+*               function(s).
+*
+* Note(s)     : (1) Interrupts MUST be disabled when this function is called.
+*
+*               (2) 关中断时间扣除测量本身的开销后,更新当前最大值、总最大值(及其位置)和直方图.
+*********************************************************************************************************
+*/
+
+#ifdef  CPU_CFG_INT_DIS_MEAS_EN
+void  CPU_IntDisMeasStop (void)
+{
+    CPU_TS_TMR  time_ints_disd_cnts;
+    CPU_INT16U  bucket;
+
+
+    if (CPU_IntDisNestCtr == 0u) {                              /* Unbalanced crit section, nothing to measure.         */
+        return;
+    }
+    CPU_IntDisNestCtr--;
+    if (CPU_IntDisNestCtr == 0u) {                              /* If ints NO longer dis'd, ...                         */
+        time_ints_disd_cnts = CPU_TS_TmrRd() - CPU_IntDisMeasStart_cnts;
+        if (time_ints_disd_cnts > CPU_IntDisMeasOvrhd_cnts) {   /* ... remove meas ovrhd (see Note #2).                 */
+            time_ints_disd_cnts -= CPU_IntDisMeasOvrhd_cnts;
+        } else {
+            time_ints_disd_cnts  = 0u;
+        }
+
+        if (CPU_IntDisMeasMaxCur_cnts < time_ints_disd_cnts) {
+            CPU_IntDisMeasMaxCur_cnts = time_ints_disd_cnts;
+        }
+        if (CPU_IntDisMeasMax_cnts    < time_ints_disd_cnts) {
+            CPU_IntDisMeasMax_cnts    = time_ints_disd_cnts;
+            CPU_IntDisMeasMaxFile     = CPU_IntDisMeasStartFile;
+            CPU_IntDisMeasMaxLine     = CPU_IntDisMeasStartLine;
+        }
+
+        bucket = 0u;                                            /* Bucket n : [2^n, 2^(n+1)) cnts.                      */
+        while ((time_ints_disd_cnts >  1u) &&
+               (bucket              < (CPU_CFG_INT_DIS_MEAS_HIST_SIZE - 1u))) {
+            time_ints_disd_cnts >>= 1u;
+            bucket++;
+        }
+        CPU_IntDisMeasHist[bucket]++;
+    }
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                     CPU_IntDisMeasMaxCurReset()
+*
+* Description : Reset current maximum interrupts disabled time.
+*
+* Argument(s) : none.
+*
+* Return(s)   : Maximum interrupts disabled time (in CPU timestamp timer counts) before resetting.
+*
+* Caller(s)   : OSTaskSwHook(),
+*               Application.
+*
+*               This function is a CPU module application programming interface (API) function & MAY be
+*               called by application function(s).
+*
+* Note(s)     : (1) 此函数内部使用CPU_INT_DIS()/CPU_INT_EN()而非CPU_CRITICAL_ENTER()/CPU_CRITICAL_EXIT(),
+*                   以免测量自身.
+*********************************************************************************************************
+*/
+
+#ifdef  CPU_CFG_INT_DIS_MEAS_EN
+CPU_TS_TMR  CPU_IntDisMeasMaxCurReset (void)
+{
+    CPU_TS_TMR  time_max_cnts;
+    CPU_SR_ALLOC();
+
+
+    CPU_INT_DIS();
+    time_max_cnts             = CPU_IntDisMeasMaxCur_cnts;
+    CPU_IntDisMeasMaxCur_cnts = 0u;
+    CPU_INT_EN();
+
+    return (time_max_cnts);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                      CPU_IntDisMeasMaxCurGet()
+*
+* Description : Get current maximum interrupts disabled time.
+*
+* Argument(s) : none.
+*
+* Return(s)   : Current maximum interrupts disabled time (in CPU timestamp timer counts).
+*
+* Caller(s)   : Application.
+*
+*               This function is a CPU module application programming interface (API) function & MAY be
+*               called by application function(s).
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+#ifdef  CPU_CFG_INT_DIS_MEAS_EN
+CPU_TS_TMR  CPU_IntDisMeasMaxCurGet (void)
+{
+    CPU_TS_TMR  time_max_cnts;
+    CPU_SR_ALLOC();
+
+
+    CPU_INT_DIS();
+    time_max_cnts = CPU_IntDisMeasMaxCur_cnts;
+    CPU_INT_EN();
+
+    return (time_max_cnts);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                       CPU_IntDisMeasMaxGet()
+*
+* Description : Get (non-resetable) maximum interrupts disabled time.
+*
+* Argument(s) : none.
+*
+* Return(s)   : Maximum interrupts disabled time (in CPU timestamp timer counts) since CPU_Init() or the
+*               last CPU_IntDisMeasReset().
+*
+* Caller(s)   : Application.
+*
+*               This function is a CPU module application programming interface (API) function & MAY be
+*               called by application function(s).
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+#ifdef  CPU_CFG_INT_DIS_MEAS_EN
+CPU_TS_TMR  CPU_IntDisMeasMaxGet (void)
+{
+    CPU_TS_TMR  time_max_cnts;
+    CPU_SR_ALLOC();
+
+
+    CPU_INT_DIS();
+    time_max_cnts = CPU_IntDisMeasMax_cnts;
+    CPU_INT_EN();
+
+    return (time_max_cnts);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                     CPU_IntDisMeasMaxSiteGet()
+*
+* Description : Get the call site of the maximum interrupts disabled time.
+*
+* Argument(s) : p_file      Pointer to variable that will receive the source file name (may be NULL pointer
+*                           if no critical section was measured yet).
+*
+*               p_line      Pointer to variable that will receive the source line number.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+*               This function is a CPU module application programming interface (API) function & MAY be
+*               called by application function(s).
+*
+* Note(s)     : (1) 位置为最外层CPU_CRITICAL_ENTER()所在的源文件及行号.
+*********************************************************************************************************
+*/
+
+#ifdef  CPU_CFG_INT_DIS_MEAS_EN
+void  CPU_IntDisMeasMaxSiteGet (const  CPU_CHAR   **p_file,
+                                       CPU_INT32U  *p_line)
+{
+    CPU_SR_ALLOC();
+
+
+    CPU_INT_DIS();
+    if (p_file != (const CPU_CHAR **)0) {
+       *p_file  = CPU_IntDisMeasMaxFile;
+    }
+    if (p_line != (CPU_INT32U *)0) {
+       *p_line  = CPU_IntDisMeasMaxLine;
+    }
+    CPU_INT_EN();
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                       CPU_IntDisMeasHistGet()
+*
+* Description : Get a copy of the interrupts disabled time histogram.
+*
+* Argument(s) : p_hist      Pointer to array that will receive the histogram buckets.
+*
+*               nbr         Number of entries in 'p_hist' (at most CPU_CFG_INT_DIS_MEAS_HIST_SIZE are copied).
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+*               This function is a CPU module application programming interface (API) function & MAY be
+*               called by application function(s).
+*
+* Note(s)     : (1) See 'cpu_cfg.h  CPU INTERRUPTS DISABLED TIME MEASUREMENT CONFIGURATION  Note #3'.
+*********************************************************************************************************
+*/
+
+#ifdef  CPU_CFG_INT_DIS_MEAS_EN
+void  CPU_IntDisMeasHistGet (CPU_INT32U  *p_hist,
+                             CPU_INT16U   nbr)
+{
+    CPU_INT16U  i;
+    CPU_SR_ALLOC();
+
+
+    if (p_hist == (CPU_INT32U *)0) {
+        return;
+    }
+    if (nbr > CPU_CFG_INT_DIS_MEAS_HIST_SIZE) {
+        nbr = CPU_CFG_INT_DIS_MEAS_HIST_SIZE;
+    }
+    CPU_INT_DIS();
+    for (i = 0u; i < nbr; i++) {
+        p_hist[i] = CPU_IntDisMeasHist[i];
+    }
+    CPU_INT_EN();
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                        CPU_IntDisMeasReset()
+*
+* Description : Reset all interrupts disabled time measurements (maximum, call site & histogram).
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+*               This function is a CPU module application programming interface (API) function & MAY be
+*               called by application function(s).
+*
+* Note(s)     : (1) 测量开销(CPU_IntDisMeasOvrhd_cnts)不会被复位.
+*********************************************************************************************************
+*/
+
+#ifdef  CPU_CFG_INT_DIS_MEAS_EN
+void  CPU_IntDisMeasReset (void)
+{
+    CPU_INT16U  i;
+    CPU_SR_ALLOC();
+
+
+    CPU_INT_DIS();
+    CPU_IntDisMeasCtr         = 0u;
+    CPU_IntDisMeasMaxCur_cnts = 0u;
+    CPU_IntDisMeasMax_cnts    = 0u;
+    CPU_IntDisMeasMaxFile     = (const CPU_CHAR *)0;
+    CPU_IntDisMeasMaxLine     = 0u;
+    for (i = 0u; i < CPU_CFG_INT_DIS_MEAS_HIST_SIZE; i++) {
+        CPU_IntDisMeasHist[i] = 0u;
+    }
+    CPU_INT_EN();
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *********************************************************************************************************
@@ -326,3 +853,88 @@ static  void  CPU_NameInit (void)
     CPU_NameClr();
 }
 #endif
+
+
+/*
+*********************************************************************************************************
+*                                            CPU_TS_Init()
+*
+* Description : (1) Initialize CPU timestamp :
+*
+*                   (a) Initialize/start CPU timestamp timer
+*                   (b) Initialize       CPU timestamp controls
+*
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : CPU_Init().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+#if (CPU_CFG_TS_TMR_EN == DEF_ENABLED)
+static  void  CPU_TS_Init (void)
+{
+    CPU_TS_TmrFreq_Hz = 0u;                                     /* Init/clr     ts tmr freq (see Note #1a).             */
+    CPU_TS_TmrInit();                                           /* Init & start ts tmr      (see Note #1a).             */
+
+#if (CPU_CFG_TS_64_EN == DEF_ENABLED)
+    CPU_TS_64_Accum   = 0u;                                     /* Init 64-bit CPU ts accum (see Note #1b).             */
+    CPU_TS_64_TmrPrev = CPU_TS_TmrRd();
+#endif
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                        CPU_IntDisMeasInit()
+*
+* Description : (1) Initialize interrupts disabled time measurements feature :
+*
+*                   (a) Initialize interrupts disabled time measurement controls
+*                   (b) Calculate  interrupts disabled time measurement overhead
+*
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : CPU_Init().
+*
+* Note(s)     : (2) CPU_TS_Init() MUST precede this function, since the overhead is measured with the
+*                   CPU timestamp timer.
+*
+*               (3) 测量开销取CPU_CFG_INT_DIS_MEAS_OVRHD_NBR次空临界区时间的平均值.
+*********************************************************************************************************
+*/
+
+#ifdef  CPU_CFG_INT_DIS_MEAS_EN
+static  void  CPU_IntDisMeasInit (void)
+{
+    CPU_TS_TMR  time_meas_tot_cnts;
+    CPU_INT16U  i;
+    CPU_SR_ALLOC();
+
+                                                                /* ----------- INIT INT DIS TIME MEAS CTRLS ----------- */
+    CPU_IntDisMeasOvrhd_cnts = 0u;
+    CPU_IntDisMeasReset();
+                                                                /* ----------- CALC INT DIS TIME MEAS OVRHD ----------- */
+    time_meas_tot_cnts = 0u;
+    CPU_INT_DIS();                                              /* Dis ints while measuring ovrhd (see Note #3).        */
+    for (i = 0u; i < CPU_CFG_INT_DIS_MEAS_OVRHD_NBR; i++) {
+        CPU_IntDisMeasMaxCur_cnts = 0u;
+        CPU_IntDisMeasStart((const CPU_CHAR *)0, 0u);           /* Perform multiple consecutive start/stop time meas's  */
+        CPU_IntDisMeasStop();
+        time_meas_tot_cnts += CPU_IntDisMeasMaxCur_cnts;        /* ...       & sum time meas max's                  ... */
+    }
+                                                                /* ... to calc avg time meas ovrhd (see Note #3).       */
+    CPU_IntDisMeasOvrhd_cnts  = time_meas_tot_cnts / CPU_CFG_INT_DIS_MEAS_OVRHD_NBR;
+    CPU_INT_EN();
+
+    CPU_IntDisMeasReset();                                      /* Discard ovrhd meas's.                                */
+}
+#endif
@@ -177,9 +177,16 @@ typedef  CPU_INT64U  CPU_TS64;
 
 typedef  CPU_TS32    CPU_TS;                                    /* Req'd for backwards-compatibility.                   */
 
+typedef  CPU_INT32U  CPU_TS_TMR;                                /* CPU timestamp timer (see Note #1).                   */
+
+typedef  CPU_INT32U  CPU_TS_TMR_FREQ;
+
 /*
 *********************************************************************************************************
 *                                          GLOBAL VARIABLES
+*
+* Note(s) : (1) CPU_IntDisMeasMaxCur_cnts记录自上次调用CPU_IntDisMeasMaxCurReset()以来的关中断最大时间.
+*               uCOS-III在任务切换时复位该值,以统计每个任务的关中断最大时间.
 *********************************************************************************************************
 */
 
@@ -187,6 +194,32 @@ typedef  CPU_TS32    CPU_TS;                                    /* Req'd for bac
 CPU_CORE_EXT  CPU_CHAR         CPU_Name[CPU_CFG_NAME_SIZE];     /* CPU host name.                                       */
 #endif
 
+#if  (CPU_CFG_TS_64_EN == DEF_ENABLED)
+CPU_CORE_EXT  CPU_TS64         CPU_TS_64_Accum;                 /* 64-bit CPU timestamp accumulator.                    */
+CPU_CORE_EXT  CPU_TS_TMR       CPU_TS_64_TmrPrev;               /* 64-bit CPU timestamp previous timer cnts.            */
+#endif
+
+#if  (CPU_CFG_TS_TMR_EN == DEF_ENABLED)
+CPU_CORE_EXT  CPU_TS_TMR_FREQ  CPU_TS_TmrFreq_Hz;               /* CPU timestamp timer frequency.                       */
+#endif
+
+#ifdef  CPU_CFG_INT_DIS_MEAS_EN
+CPU_CORE_EXT  CPU_INT16U       CPU_IntDisMeasCtr;               /* Nbr tot    ints dis'd ctr.                           */
+CPU_CORE_EXT  CPU_INT16U       CPU_IntDisNestCtr;               /* Nbr nested ints dis'd ctr.                           */
+                                                                /* Ints dis'd time (in ts tmr cnts) : ...               */
+CPU_CORE_EXT  CPU_TS_TMR       CPU_IntDisMeasStart_cnts;        /* ...  start time.                                     */
+CPU_CORE_EXT  CPU_TS_TMR       CPU_IntDisMeasMaxCur_cnts;       /* ...  max   time (see Note #1).                       */
+CPU_CORE_EXT  CPU_TS_TMR       CPU_IntDisMeasMax_cnts;          /* ...  max   time (since CPU_Init()/last reset).       */
+CPU_CORE_EXT  CPU_TS_TMR       CPU_IntDisMeasOvrhd_cnts;        /* ...  time meas ovrhd.                                */
+                                                                /* ...  histogram (see 'cpu_cfg.h  Note #3').           */
+CPU_CORE_EXT  CPU_INT32U       CPU_IntDisMeasHist[CPU_CFG_INT_DIS_MEAS_HIST_SIZE];
+                                                                /* Ints dis'd call site : ...                           */
+CPU_CORE_EXT  const CPU_CHAR  *CPU_IntDisMeasStartFile;         /* ...  of current crit section.                        */
+CPU_CORE_EXT  CPU_INT32U       CPU_IntDisMeasStartLine;
+CPU_CORE_EXT  const CPU_CHAR  *CPU_IntDisMeasMaxFile;           /* ...  of max     crit section.                        */
+CPU_CORE_EXT  CPU_INT32U       CPU_IntDisMeasMaxLine;
+#endif
+
 /*
 *********************************************************************************************************
 *                                               MACRO'S
@@ -414,6 +447,45 @@ void             CPU_SW_Exception         (void);
 
 
 
+#if (CPU_CFG_TS_32_EN == DEF_ENABLED)                                   /* ------------- CPU TS FNCTS --------------- */
+CPU_TS32         CPU_TS_Get32             (void);
+#endif
+
+#if (CPU_CFG_TS_64_EN == DEF_ENABLED)
+CPU_TS64         CPU_TS_Get64             (void);
+#endif
+
+#if (CPU_CFG_TS_EN    == DEF_ENABLED)
+void             CPU_TS_Update            (void);
+#endif
+
+
+#if (CPU_CFG_TS_TMR_EN == DEF_ENABLED)                                  /* ----------- CPU TS TMR FNCTS ------------- */
+CPU_TS_TMR_FREQ  CPU_TS_TmrFreqGet        (CPU_ERR          *p_err);
+
+void             CPU_TS_TmrFreqSet        (CPU_TS_TMR_FREQ   freq_hz);
+#endif
+
+
+
+#ifdef  CPU_CFG_INT_DIS_MEAS_EN                                         /* -------- CPU INT DIS TIME MEAS FNCTS ------- */
+CPU_TS_TMR       CPU_IntDisMeasMaxCurReset(void);
+
+CPU_TS_TMR       CPU_IntDisMeasMaxCurGet  (void);
+
+CPU_TS_TMR       CPU_IntDisMeasMaxGet     (void);
+
+void             CPU_IntDisMeasMaxSiteGet (const  CPU_CHAR **p_file,
+                                                  CPU_INT32U *p_line);
+
+void             CPU_IntDisMeasHistGet    (       CPU_INT32U *p_hist,
+                                                  CPU_INT16U  nbr);
+
+void             CPU_IntDisMeasReset      (void);
+#endif
+
+
+
 #if (CPU_CFG_NAME_EN == DEF_ENABLED)                                    /* -------------- CPU NAME FNCTS -------------- */
 void             CPU_NameClr              (void);
 
@@ -425,4 +497,20 @@ void             CPU_NameSet              (const  CPU_CHAR  *p_name,
 #endif
 
 
+/*
+*********************************************************************************************************
+*                                  FUNCTION PROTOTYPES DEFINED IN BSP
+*
+* Note(s) : (1) The CPU timestamp timer functions are product/BSP-specific.  Default (weak) versions are
+*               provided in cpu_a.c (see also 'cpu_cfg.h  CPU TIMESTAMP CONFIGURATION  Note #2').
+*********************************************************************************************************
+*/
+
+#if (CPU_CFG_TS_TMR_EN == DEF_ENABLED)
+void             CPU_TS_TmrInit           (void);
+
+CPU_TS_TMR       CPU_TS_TmrRd             (void);
+#endif
+
+
 #endif                                                          /* End of CPU core module include.                      */
@@ -129,6 +129,60 @@ extern "C" {
 #define  OS_EXT  extern
 #endif
 
+#if (CPU_CFG_TS_TMR_EN == DEF_ENABLED)
+#define  OS_TS_GET()               (CPU_TS)CPU_TS_TmrRd()   /* Timestamp is read from a timer / cycle counter           */
+#else
+#define  OS_TS_GET()               (CPU_TS)rt_tick_get()    /* 未提供时间戳定时器时,以OS节拍作为时间戳(精度较低)        */
+#endif
+
+#define  OS_TASK_FLAG_OS_TCB       0x40u                    /* rt_thread.flags中标记该线程由OSTaskCreate()创建的位      */
+                                                            /* 判断线程是否由OSTaskCreate()创建(即是否为OS_TCB)         */
+#define  OS_TASK_IS_OS_TCB(p_thread)  ((((rt_thread_t)(p_thread))->flags & OS_TASK_FLAG_OS_TCB) != 0u)
+
+#if OS_CFG_TASK_STK_CANARY_EN > 0u
+#define  OS_TASK_STK_CANARY_NBR    2u                       /* 栈金丝雀占用的CPU_STK数                                  */
+#define  OS_TASK_STK_CANARY        ((CPU_STK)0xC0DEFEEDu)   /* 金丝雀值,不能与'#'填充值相同                             */
+#endif
+
+                                                            /* ------------------- TRACE EVENTS ------------------- */
+#define  OS_TRACE_EV_NONE                  0u               /* Unused record                                            */
+#define  OS_TRACE_EV_NAME                  1u               /* Object name  (Obj = object, Task/Arg = name)             */
+#define  OS_TRACE_EV_TASK_SW               2u               /* Task switch  (Task = from,  Obj = to)                    */
+#define  OS_TRACE_EV_ISR_ENTER             3u
+#define  OS_TRACE_EV_ISR_EXIT              4u
+#define  OS_TRACE_EV_TIME_DLY              5u               /* Arg = dly                                                */
+#define  OS_TRACE_EV_TIME_DLY_EXIT         6u               /* Arg = err                                                */
+#define  OS_TRACE_EV_TMR_EXPIRE            7u               /* Obj = timer                                              */
+#define  OS_TRACE_EV_SEM_POST             16u               /* Arg = opt                                                */
+#define  OS_TRACE_EV_SEM_PEND             17u               /* Arg = timeout                                            */
+#define  OS_TRACE_EV_SEM_PEND_EXIT        18u               /* Arg = err                                                */
+#define  OS_TRACE_EV_MUTEX_POST           19u
+#define  OS_TRACE_EV_MUTEX_PEND           20u
+#define  OS_TRACE_EV_MUTEX_PEND_EXIT      21u
+#define  OS_TRACE_EV_Q_POST               22u               /* Arg = msg_size                                           */
+#define  OS_TRACE_EV_Q_PEND               23u
+#define  OS_TRACE_EV_Q_PEND_EXIT          24u
+#define  OS_TRACE_EV_FLAG_POST            25u               /* Arg = flags                                              */
+#define  OS_TRACE_EV_FLAG_PEND            26u
+#define  OS_TRACE_EV_FLAG_PEND_EXIT       27u
+#define  OS_TRACE_EV_REPOST           0x8000u               /* 标志位:中断处理任务代为完成的延迟发布                    */
+
+#if OS_CFG_TRACE_EN > 0u                                    /* 关闭时不生成任何代码                                     */
+#define  OS_TRACE(event, p_obj, arg)       OS_TraceRec((CPU_INT16U)(event), (void *)(p_obj), (CPU_INT32U)(arg))
+#define  OS_TRACE_NAME(p_obj, p_name)      OS_TraceName((void *)(p_obj), (const CPU_CHAR *)(p_name))
+#else
+#define  OS_TRACE(event, p_obj, arg)
+#define  OS_TRACE_NAME(p_obj, p_name)
+#endif
+
+#if (OS_CFG_TASK_PROFILE_EN > 0u) || ((OS_CFG_STAT_TASK_EN > 0u) && (OS_CFG_STAT_TASK_TS_EN > 0u)) || \
+    (defined(CPU_CFG_INT_DIS_MEAS_EN) && defined(RT_USING_HOOK)) || ((OS_CFG_TRACE_EN > 0u) && defined(RT_USING_HOOK)) || \
+    ((OS_CFG_TASK_STK_CANARY_EN > 0u) && defined(RT_USING_HOOK))
+#define  OS_TASK_SW_HOOK_EN        1u                       /* 需要向RT-Thread调度器注册OSTaskSwHook()                  */
+#else
+#define  OS_TASK_SW_HOOK_EN        0u
+#endif
+
 #ifndef  OS_FALSE
 #define  OS_FALSE                       0u
 #endif
@@ -189,7 +243,14 @@ extern "C" {
 #define  OS_TASK_PEND_ON_Q                    (OS_STATE)(  5u)  /* Pending on queue                                   */
 #define  OS_TASK_PEND_ON_SEM                  (OS_STATE)(  6u)  /* Pending on semaphore                               */
 #define  OS_TASK_PEND_ON_TASK_SEM             (OS_STATE)(  7u)  /* Pending on signal  to be sent to task              */
-//#define  OS_TASK_PEND_ON_COND                 (OS_STATE)(  8u)  /* Pending on condition variable  3.08                */
+#define  OS_TASK_PEND_ON_COND                 (OS_STATE)(  8u)  /* Pending on condition variable  3.08                */
+#define  OS_TASK_PEND_ON_TASK_NOTIFY          (OS_STATE)(  9u)  /* Pending on notification to be sent to task        */
+#define  OS_TASK_PEND_ON_RWLOCK               (OS_STATE)( 10u)  /* Pending on reader-writer lock                      */
+
+                                                                /* ------------------ TASK NOTIFY STATE ----------------- */
+#define  OS_TASK_NOTIFY_NONE                  (OS_STATE)(  0u)  /* No notification pending and task not waiting       */
+#define  OS_TASK_NOTIFY_WAITING               (OS_STATE)(  1u)  /* Task is waiting for a notification                 */
+#define  OS_TASK_NOTIFY_PENDING               (OS_STATE)(  2u)  /* Notification received but not yet consumed        */
 
 /*
 ------------------------------------------------------------------------------------------------------------------------
@@ -214,11 +275,15 @@ extern "C" {
 */
 
 #define  OS_OBJ_TYPE_NONE                    (OS_OBJ_TYPE)CPU_TYPE_CREATE('N', 'O', 'N', 'E')
+#define  OS_OBJ_TYPE_COND                    (OS_OBJ_TYPE)CPU_TYPE_CREATE('C', 'O', 'N', 'D')
 #define  OS_OBJ_TYPE_FLAG                    (OS_OBJ_TYPE)CPU_TYPE_CREATE('F', 'L', 'A', 'G')
 #define  OS_OBJ_TYPE_MEM                     (OS_OBJ_TYPE)CPU_TYPE_CREATE('M', 'E', 'M', ' ')
 #define  OS_OBJ_TYPE_MUTEX                   (OS_OBJ_TYPE)CPU_TYPE_CREATE('M', 'U', 'T', 'X')
 #define  OS_OBJ_TYPE_Q                       (OS_OBJ_TYPE)CPU_TYPE_CREATE('Q', 'U', 'E', 'U')
+#define  OS_OBJ_TYPE_Q_PRIO                  (OS_OBJ_TYPE)CPU_TYPE_CREATE('Q', 'P', 'R', 'I')
+#define  OS_OBJ_TYPE_RWLOCK                  (OS_OBJ_TYPE)CPU_TYPE_CREATE('R', 'W', 'L', 'K')
 #define  OS_OBJ_TYPE_SEM                     (OS_OBJ_TYPE)CPU_TYPE_CREATE('S', 'E', 'M', 'A')
+#define  OS_OBJ_TYPE_TASK_NOTIFY             (OS_OBJ_TYPE)CPU_TYPE_CREATE('T', 'N', 'T', 'F')
 #define  OS_OBJ_TYPE_TMR                     (OS_OBJ_TYPE)CPU_TYPE_CREATE('T', 'M', 'R', ' ')
 
 /*
@@ -290,6 +355,15 @@ extern "C" {
 
 #define  OS_OPT_POST_NO_SCHED                (OS_OPT)(0x8000u)  /* Do not call the scheduler if this is selected      */
 
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                    MEMORY OPTIONS
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+#define  OS_OPT_MEM_ALL                      (OS_OPT)(0x0000u)  /* OSMemGetN()/OSMemPutN() all blocks or none         */
+#define  OS_OPT_MEM_PARTIAL                  (OS_OPT)(0x0001u)  /* OSMemGetN()/OSMemPutN() as many blocks as possible */
+
 /*
 ------------------------------------------------------------------------------------------------------------------------
 *                                                     TASK OPTIONS
@@ -302,6 +376,18 @@ extern "C" {
 #define  OS_OPT_TASK_SAVE_FP                 (OS_OPT)(0x0004u)  /* Save the contents of any floating-point registers  */
 #define  OS_OPT_TASK_NO_TLS                  (OS_OPT)(0x0008u)  /* Specifies the task DOES NOT require TLS support    */
 
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                  TASK NOTIFY OPTIONS
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+#define  OS_OPT_TASK_NOTIFY_NONE             (OS_OPT)(0x0000u)  /* Notify without changing the notification value     */
+#define  OS_OPT_TASK_NOTIFY_SET_BITS         (OS_OPT)(0x0001u)  /* OR 'value' into the notification value             */
+#define  OS_OPT_TASK_NOTIFY_INC              (OS_OPT)(0x0002u)  /* Increment the notification value                   */
+#define  OS_OPT_TASK_NOTIFY_OVERWRITE        (OS_OPT)(0x0003u)  /* Overwrite the notification value with 'value'      */
+#define  OS_OPT_TASK_NOTIFY_OVERWRITE_NO     (OS_OPT)(0x0004u)  /* Overwrite only if no notification is pending       */
+
 /*
 ------------------------------------------------------------------------------------------------------------------------
 *                                                     TIME OPTIONS
@@ -341,6 +427,8 @@ extern "C" {
 #define  OS_OPT_TMR_CALLBACK                      (OS_OPT)(3u)  /* OSTmrStop() option to call 'callback' w/ timer arg */
 #define  OS_OPT_TMR_CALLBACK_ARG                  (OS_OPT)(4u)  /* OSTmrStop() option to call 'callback' w/ new   arg */
 
+#define  OS_OPT_TMR_HARD                     (OS_OPT)(0x0100u)  /* 与ONE_SHOT/PERIODIC组合,回调在时钟中断中执行       */
+
 /*
 ------------------------------------------------------------------------------------------------------------------------
 *                                                     TIMER STATES
@@ -406,6 +494,11 @@ typedef  enum  os_err {
 
     OS_ERR_I                         = 18000u,
     OS_ERR_ILLEGAL_CREATE_RUN_TIME   = 18001u,
+    OS_ERR_INT_Q                     = 18002u,
+    OS_ERR_INT_Q_FULL                = 18003u,
+    OS_ERR_INT_Q_SIZE                = 18004u,
+    OS_ERR_INT_Q_STK_INVALID         = 18005u,
+    OS_ERR_INT_Q_STK_SIZE_INVALID    = 18006u,
     OS_ERR_ILLEGAL_DEL_RUN_TIME      = 18007u,
 
     OS_ERR_J                         = 19000u,
@@ -601,6 +694,12 @@ typedef  enum  os_err {
     /*兼容层新增错误码*/
     OS_ERR_TASK_SEM_CREATE_FALSE     = 37001u,/*任务内建信号量创建失败*/
     OS_ERR_TASK_Q_CREATE_FALSE       = 37002u,/*任务内建消息队列创建失败*/
+    OS_ERR_TASK_NOTIFY_PENDING       = 37003u,/*任务已有未处理的通知,OS_OPT_TASK_NOTIFY_OVERWRITE_NO未能写入*/
+    OS_ERR_Q_MSG_SIZE                = 37004u,/*消息长度超过拷贝模式消息队列的元素长度*/
+    OS_ERR_RWLOCK_OWNER              = 37005u,/*当前任务已经持有该读写锁的写锁*/
+    OS_ERR_RWLOCK_NOT_OWNER          = 37006u,/*当前任务没有持有该读写锁*/
+    OS_ERR_RWLOCK_OVF                = 37007u,/*读写锁的读者计数溢出*/
+    OS_ERR_COND_MUTEX                = 37008u,/*与正在等待该条件变量的任务使用的互斥量不同*/
 } OS_ERR;
 
 
@@ -617,12 +716,23 @@ typedef  struct  os_q                OS_Q;
 
 typedef  struct  os_mutex            OS_MUTEX;
 
+typedef  struct  os_rwlock           OS_RWLOCK;
+
+typedef  struct  os_cond             OS_COND;
+
 typedef  struct  os_sem              OS_SEM;
 
 typedef  struct  os_flag_grp         OS_FLAG_GRP;
 
+typedef  struct  os_int_q            OS_INT_Q;
+
+typedef  struct  os_trace_rec        OS_TRACE_REC;
+
+typedef  struct  os_obj_stat         OS_OBJ_STAT;
+
 typedef  void                      (*OS_TMR_CALLBACK_PTR)  (void *p_tmr, void *p_arg);
 typedef  struct  os_tmr              OS_TMR;
+typedef  void                      (*OS_TMR_HARD_CALLBACK_PTR)(OS_TMR *p_tmr, void *p_arg);
 
 typedef  void                      (*OS_TASK_PTR)          (void *p_arg);
 typedef  struct  os_tcb              OS_TCB;
@@ -632,6 +742,12 @@ typedef  void                      (*OS_APP_HOOK_VOID)     (void);
 typedef  void                      (*OS_APP_HOOK_TCB)      (OS_TCB *p_tcb);
 #endif
 
+#if defined(OS_CFG_TLS_TBL_SIZE) && (OS_CFG_TLS_TBL_SIZE > 0u)
+typedef  void                      *OS_TLS;
+typedef  CPU_DATA                   OS_TLS_ID;
+typedef  void                      (*OS_TLS_DESTRUCT_PTR)  (OS_TCB *p_tcb, OS_TLS_ID id, OS_TLS value);
+#endif
+
 /*
 ************************************************************************************************************************
 ************************************************************************************************************************
@@ -640,6 +756,29 @@ typedef  void                      (*OS_APP_HOOK_TCB)      (OS_TCB *p_tcb);
 ************************************************************************************************************************
 */
 
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                             PER-OBJECT CONTENTION STATISTICS
+*
+* Note(s) : 1) 只在等待真正需要阻塞时(慢速路径)更新,资源可用时的快速路径只多一次PendCtr自增.
+*
+*           2) 阻塞时间以时钟节拍为单位;PendWaiters为当前正在该对象上阻塞的任务数.
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+#if OS_CFG_OBJ_STAT_EN > 0u
+struct  os_obj_stat {
+    OS_CTR               PendCtr;                           /* 调用等待函数的总次数                                   */
+    OS_CTR               PendBlockCtr;                      /* 其中需要阻塞的次数                                     */
+    OS_CTR               PendTimeoutCtr;                    /* 阻塞后超时的次数                                       */
+    OS_CTR               PendAbortCtr;                      /* 阻塞后被OSxxxPendAbort()中止的次数                     */
+    OS_TICK              PendBlockTicksTotal;               /* 累计阻塞时间                                           */
+    OS_TICK              PendBlockTicksMax;                 /* 单次最长阻塞时间                                       */
+    OS_OBJ_QTY           PendWaiters;                       /* 当前阻塞的任务数                                       */
+    OS_OBJ_QTY           PendWaitersMax;                    /* 同时阻塞任务数的峰值                                   */
+};
+#endif
+
 /*
 ------------------------------------------------------------------------------------------------------------------------
 *                                                    MESSAGE QUEUES
@@ -665,13 +804,38 @@ typedef  struct                                            /* uCOS消息段
 {
     rt_uint8_t *data_ptr;                                  /* uCOS-III消息数据指针                                    */
     rt_uint32_t data_size;                                 /* uCOS-III消息数据长度                                    */
+#if OS_CFG_TS_EN > 0u
+    CPU_TS      ts;                                        /* 消息发布时的时间戳                                      */
+#endif
 }ucos_msg_t;
 
+/*拷贝模式消息队列存储区大小(字节),用于OSQCreateCopy(),RTT会将元素长度按RT_ALIGN_SIZE对齐*/
+#define  OS_Q_COPY_STORAGE_SIZE(max_qty, msg_size)  \
+         ((rt_size_t)(max_qty) * (sizeof(struct _rt_mq_message) + RT_ALIGN((rt_size_t)(msg_size), RT_ALIGN_SIZE)))
+
+/*指针模式消息队列存储区大小(字节),用于OSQCreateStatic(),每条消息为一个按RT_ALIGN_SIZE对齐的ucos_msg_t*/
+#define  OS_Q_STORAGE_SIZE(max_qty)         OS_Q_COPY_STORAGE_SIZE(max_qty, sizeof(ucos_msg_t))
+
 struct os_q
 {
     struct  rt_messagequeue Msg;
-    void                *p_pool;
+    void                *p_pool;                           /* 由堆分配的消息缓冲区,静态创建时为NULL                   */
     ucos_msg_t           ucos_msg;
+#if OS_CFG_TS_EN > 0u
+    CPU_TS               TS;                               /* 最近一次发布的时间戳(拷贝模式的消息中不含时间戳)        */
+#endif
+#if OS_CFG_Q_COPY_EN > 0u
+    OS_MSG_SIZE          MsgSize;                          /* 拷贝模式下每条消息的固定长度,传递指针模式为0            */
+#endif
+#if OS_CFG_OBJ_STAT_EN > 0u
+    OS_OBJ_STAT          Stat;                             /* 竞争统计                                                */
+    OS_MSG_QTY           MsgQtyMax;                        /* 队列中消息数的峰值                                      */
+#endif
+#if OS_CFG_Q_PRIO_EN > 0u
+    OS_MSG_QTY           PrioEntries;                      /* 各优先级桶中消息数之和(上次同步时)                      */
+    OS_MSG_QTY           PrioCtr[OS_CFG_Q_PRIO_LEVELS];    /* 各优先级桶中的消息数                                    */
+    void                *PrioTailPtr[OS_CFG_Q_PRIO_LEVELS];/* 各优先级桶中最后一条消息                                */
+#endif
 #ifndef PKG_USING_UCOSIII_WRAPPER_TINY
     OS_OBJ_TYPE          Type;
 #if (OS_CFG_DBG_EN > 0u)
@@ -684,6 +848,53 @@ struct os_q
 };
 #endif
 
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                  ISR POST DEFERRAL
+*
+* Note(s) : 中断中调用OSSemPost()/OSQPost()/OSFlagPost()时,只将发布请求记录到环形队列中,由最高优先级的中断处理任务
+*           在任务级批量重新发布,使关中断时间与等待该内核对象的任务数量无关
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+#if OS_CFG_ISR_POST_DEFERRED_EN > 0u
+struct  os_int_q {
+    OS_OBJ_TYPE          Type;                              /* Type of object placed in the circular list             */
+    OS_INT_Q            *NextPtr;                           /* Pointer to next OS_INT_Q in  circular list             */
+    void                *ObjPtr;                            /* Pointer to object placed in the queue                  */
+    void                *MsgPtr;                            /* Pointer to message if posting to a message queue       */
+    OS_MSG_SIZE          MsgSize;                           /* Message Size       if posting to a message queue       */
+    OS_FLAGS             Flags;                             /* Value of flags if posting to an event flag group       */
+#if OS_CFG_Q_PRIO_EN > 0u
+    OS_PRIO              Prio;                              /* 消息优先级,仅用于OSQPostPrio()                         */
+#endif
+    OS_OPT               Opt;                               /* Post Options                                           */
+    CPU_TS               TS;                                /* Timestamp                                              */
+};
+#endif
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                   TRACE RECORDER
+*
+* Note(s) : 1) 每条记录固定20字节,全部为32位对齐的小端整数,便于在主机端直接解析OSCfg_TraceBuf[]的内存转储.
+*
+*           2) Task/Obj为内核对象地址的低32位;OS_TRACE_EV_NAME记录中,Obj为对象地址,Task和Arg依次存放对象名称的
+*              前8个字符.
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+#if OS_CFG_TRACE_EN > 0u
+struct  os_trace_rec {
+    CPU_TS32             TS;                                /* Timestamp (OS_TS_GET())                                */
+    CPU_INT16U           Event;                             /* Event ID, see OS_TRACE_EV_xxx                          */
+    CPU_INT16U           IntNest;                           /* 记录时的中断嵌套层数,大于0表示在中断中记录             */
+    CPU_INT32U           Task;                              /* 当前线程                                               */
+    CPU_INT32U           Obj;                               /* 相关的内核对象                                         */
+    CPU_INT32U           Arg;                               /* 事件参数(超时时间、错误码、消息长度等)                 */
+};
+#endif
+
 /*
 ------------------------------------------------------------------------------------------------------------------------
 *                                                      SEMAPHORES
@@ -692,6 +903,12 @@ struct os_q
 
 struct  os_sem {
     struct  rt_semaphore  Sem;
+#if OS_CFG_TS_EN > 0u
+    CPU_TS                TS;                               /* Timestamp of when last post occurred                   */
+#endif
+#if OS_CFG_OBJ_STAT_EN > 0u
+    OS_OBJ_STAT           Stat;                             /* 竞争统计                                               */
+#endif
 #ifndef PKG_USING_UCOSIII_WRAPPER_TINY
     OS_OBJ_TYPE           Type;
 #if (OS_CFG_DBG_EN > 0u)
@@ -712,6 +929,12 @@ struct  os_sem {
 
 struct  os_flag_grp {
     struct  rt_event     FlagGrp;
+#if OS_CFG_TS_EN > 0u
+    CPU_TS               TS;                                /* Timestamp of when last post occurred                   */
+#endif
+#if OS_CFG_OBJ_STAT_EN > 0u
+    OS_OBJ_STAT          Stat;                              /* 竞争统计                                               */
+#endif
 #ifndef PKG_USING_UCOSIII_WRAPPER_TINY
     OS_OBJ_TYPE          Type;
     OS_FLAGS             Flags;                             /* 8, 16 or 32 bit flags                                  */
@@ -735,16 +958,48 @@ struct os_tcb
 #if OS_CFG_TASK_SEM_EN > 0u
     OS_SEM           Sem;                                   /* 任务内建信号量                                         */
     CPU_BOOLEAN      SemCreateSuc;                          /* 标记任务内建信号量是否创建成功                         */
+    OS_SEM_CTR       SemLazyCtr;                            /* 任务内建信号量创建前累计收到的信号数                   */
+#if OS_CFG_TS_EN > 0u
+    CPU_TS           SemLazyTS;                             /* 任务内建信号量创建前最近一次发布的时间戳               */
+#endif
 #endif
 #if OS_CFG_TASK_Q_EN > 0u
     OS_Q             MsgQ;                                  /* 任务内建消息队列                                       */
     void            *MsgPtr;                                /* 任务内建消息队列消息指针                               */
     OS_MSG_SIZE      MsgSize;                               /* 任务内建消息队列消息大小                               */
     CPU_BOOLEAN      MsgCreateSuc;                          /* 标记任务内建消息队列是否创建成功                       */
+    OS_MSG_QTY       MsgQSize;                              /* 任务内建消息队列容量,首次使用时才创建                  */
+#endif
+#if OS_CFG_TASK_NOTIFY_EN > 0u
+    OS_NOTIFY_VAL    NotifyVal;                             /* 任务通知值                                             */
+    OS_STATE         NotifyState;                           /* 任务通知状态,见OS_TASK_NOTIFY_xxx                      */
 #endif
     void            *ExtPtr;                                /* 指向用户附加区指针                                     */
+#if OS_CFG_TASK_PROFILE_EN > 0u
+    OS_CTR           CtxSwCtr;                              /* Number of time the task was switched in                */
+    CPU_TS           CyclesDelta;                           /* 上一个统计周期内任务运行的时间戳增量                   */
+    CPU_TS           CyclesStart;                           /* 任务最近一次被切入时的时间戳                           */
+    OS_CYCLES        CyclesTotal;                           /* Total number of # of cycles the task has been running  */
+    OS_CYCLES        CyclesTotalPrev;                       /* Snapshot of previous # of cycles                       */
+    CPU_TS           CyclesStatTS;                          /* 统计任务上次计算该任务CPU使用率时的时间戳              */
+    OS_CPU_USAGE     CPUUsage;                              /* CPU Usage of task (0.00-100.00%)                       */
+    OS_CPU_USAGE     CPUUsageMax;                           /* CPU Usage of task (0.00-100.00%) - Peak                */
+#endif
+#ifdef CPU_CFG_INT_DIS_MEAS_EN
+    CPU_TS           IntDisTimeMax;                         /* 任务运行期间的关中断最大时间(时间戳定时器计数值)       */
+#endif
+#if (OS_CFG_MUTEX_EN > 0u) && (OS_CFG_MUTEX_PROFILE_EN > 0u)
+    OS_MUTEX        *MutexHeldPtr;                          /* 任务当前持有的互斥量链表                               */
+#endif
+#if (OS_CFG_MUTEX_EN > 0u) && (OS_CFG_MUTEX_CEILING_EN > 0u)
+    OS_MUTEX        *CeilingMutexPtr;                       /* 任务当前持有的天花板互斥量链表                         */
+    OS_PRIO          CeilingBasePrio;                       /* 获得第一个天花板互斥量之前的优先级                     */
+#endif
 #if OS_CFG_TASK_REG_TBL_SIZE > 0u
     OS_REG           RegTbl[OS_CFG_TASK_REG_TBL_SIZE];      /* 任务寄存器                                             */
+#endif
+#if defined(OS_CFG_TLS_TBL_SIZE) && (OS_CFG_TLS_TBL_SIZE > 0u)
+    OS_TLS           TLS_Tbl[OS_CFG_TLS_TBL_SIZE];          /* 任务本地存储(TLS)                                      */
 #endif
     OS_STATUS        PendStatus;                            /* Pend status：OS_STATUS_PEND_ABORT OS_STATUS_PEND_OK可用*/
 #if OS_CFG_TASK_SUSPEND_EN > 0u
@@ -753,6 +1008,9 @@ struct os_tcb
 #if OS_CFG_STAT_TASK_STK_CHK_EN > 0u
     CPU_STK_SIZE     StkUsed;                               /* Number of stack elements used from the stack           */
     CPU_STK_SIZE     StkFree;                               /* Number of stack elements free on   the stack           */
+#endif
+#if OS_CFG_TASK_STK_CANARY_EN > 0u
+    CPU_STK         *StkCanaryPtr;                          /* 栈金丝雀的起始地址,NULL表示未设置或已报告过溢出        */
 #endif
     OS_STATE         TaskState;                             /* See OS_TASK_STATE_xxx                                  */
     OS_STATE         PendOn;                                /* Indicates what task is pending on                      */
@@ -813,6 +1071,26 @@ struct os_mem {                                             /* MEMORY CONTROL BL
 
 struct  os_mutex {
     struct rt_mutex     Mutex;
+#if OS_CFG_TS_EN > 0u
+    CPU_TS              TS;                                 /* Timestamp of when last post occurred                   */
+#endif
+#if OS_CFG_OBJ_STAT_EN > 0u
+    OS_OBJ_STAT         Stat;                               /* 竞争统计                                               */
+#endif
+#if OS_CFG_MUTEX_PROFILE_EN > 0u
+    OS_TCB             *HeldTCBPtr;                         /* 正在计时的持有者,未被持有时为NULL                      */
+    OS_MUTEX           *HeldNextPtr;                        /* 持有者所持有的下一个互斥量                             */
+    CPU_TS              HeldTS;                             /* 最外层获得互斥量时的时间戳                             */
+    CPU_TS              HoldTimeMax;                        /* 最长持有时间                                           */
+    CPU_TS64            HoldTimeTotal;                      /* 累计持有时间,除以HoldCtr即为平均持有时间               */
+    OS_CTR              HoldCtr;                            /* 完整持有(获得到释放)的次数                             */
+    OS_CTR              BoostCtr;                           /* 引起优先级继承的次数                                   */
+#endif
+#if OS_CFG_MUTEX_CEILING_EN > 0u
+    OS_PRIO             CeilingPrio;                        /* 优先级天花板,OS_PRIO_INIT表示普通(优先级继承)互斥量    */
+    OS_TCB             *CeilingTCBPtr;                      /* 计入了该天花板的持有者,NULL表示未计入                  */
+    OS_MUTEX           *CeilingNextPtr;                     /* 持有者所持有的下一个天花板互斥量                       */
+#endif
 #ifndef PKG_USING_UCOSIII_WRAPPER_TINY
     OS_OBJ_TYPE         Type;
     OS_NESTING_CTR      OwnerNestingCtr;                    /* Mutex is available when the counter is 0               */
@@ -827,6 +1105,51 @@ struct  os_mutex {
 #endif
 };
 
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                 CONDITION VARIABLES
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+struct  os_cond {
+    rt_list_t           WaitList;                           /* 等待条件变量的任务,按优先级排列                        */
+    OS_OBJ_TYPE         Type;                               /* Should be set to OS_OBJ_TYPE_COND                      */
+    OS_MUTEX           *MutexPtr;                           /* 等待者使用的互斥量                                     */
+#ifndef PKG_USING_UCOSIII_WRAPPER_TINY
+#if OS_CFG_DBG_EN > 0u
+    CPU_CHAR           *NamePtr;
+    OS_COND            *DbgPrevPtr;
+    OS_COND            *DbgNextPtr;
+    CPU_CHAR           *DbgNamePtr;                         /* 等待该内核对象挂起表中第一个任务的名字                 */
+#endif
+#endif
+};
+
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                 READER-WRITER LOCKS
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+struct  os_rwlock {
+    rt_list_t           ReadWaitList;                       /* 等待读锁的任务,按优先级排列                            */
+    rt_list_t           WriteWaitList;                      /* 等待写锁的任务,按优先级排列                            */
+    OS_OBJ_TYPE         Type;                               /* Should be set to OS_OBJ_TYPE_RWLOCK                    */
+    OS_OBJ_QTY          ReaderCtr;                          /* 持有读锁的任务数                                       */
+    OS_TCB             *WriterTCBPtr;                       /* 持有写锁的任务,NULL表示写锁空闲                        */
+#if OS_CFG_TS_EN > 0u
+    CPU_TS              TS;                                 /* Timestamp of when last post occurred                   */
+#endif
+#ifndef PKG_USING_UCOSIII_WRAPPER_TINY
+#if OS_CFG_DBG_EN > 0u
+    CPU_CHAR           *NamePtr;
+    OS_RWLOCK          *DbgPrevPtr;
+    OS_RWLOCK          *DbgNextPtr;
+    CPU_CHAR           *DbgNamePtr;                         /* 等待该内核对象挂起表中第一个任务的名字                 */
+#endif
+#endif
+};
+
 /*
 ------------------------------------------------------------------------------------------------------------------------
 *                                                   TIMER DATA TYPES
@@ -844,6 +1167,10 @@ struct  os_tmr {
     OS_TICK              _set_dly;                          /* 该变量为兼容层内部使用,用于配合3.08版本中OSTmrSet函数  */
     OS_TICK              _set_period;                       /* 该变量为兼容层内部使用,用于配合3.08版本中OSTmrSet函数  */
     OS_TICK              _dly;                              /* 该变量为兼容层内部使用,用于带有延迟的周期延时          */
+#if OS_CFG_TMR_SLACK_EN > 0u
+    OS_TICK              Slack;                             /* 允许到期时刻推迟的最大值,用于合并相邻定时器的唤醒      */
+    rt_tick_t            _due;                              /* 该变量为兼容层内部使用,记录未加松弛的理想到期时刻      */
+#endif
 #ifndef PKG_USING_UCOSIII_WRAPPER_TINY
     OS_TICK              Match;                             /* Timer expires when OSTmrTickCtr matches this value     */
     OS_TICK              Remain;                            /* Amount of time remaining before timer expires          */
@@ -879,6 +1206,9 @@ OS_EXT            OS_APP_HOOK_TCB           OS_AppTaskCreateHookPtr;    /* Appli
 OS_EXT            OS_APP_HOOK_TCB           OS_AppTaskDelHookPtr;
 OS_EXT            OS_APP_HOOK_VOID          OS_AppIdleTaskHookPtr;
 OS_EXT            OS_APP_HOOK_VOID          OS_AppStatTaskHookPtr;
+#if OS_CFG_TASK_STK_CANARY_EN > 0u
+OS_EXT            OS_APP_HOOK_TCB           OS_AppTaskStkOvfHookPtr;
+#endif
 #endif
 
 OS_EXT            OS_STATE                  OSRunning;                  /* Flag indicating that kernel is running     */
@@ -916,6 +1246,26 @@ OS_EXT            OS_MUTEX                 *OSMutexDbgListPtr;
 #endif
 OS_EXT            OS_OBJ_QTY                OSMutexQty;                 /* Number of mutexes created                  */
 #endif
+#endif
+
+                                                                        /* CONDITION VARIABLES ---------------------- */
+#if OS_CFG_COND_EN > 0u
+#ifndef PKG_USING_UCOSIII_WRAPPER_TINY
+#if OS_CFG_DBG_EN > 0u
+OS_EXT            OS_COND                  *OSCondDbgListPtr;
+#endif
+OS_EXT            OS_OBJ_QTY                OSCondQty;                  /* Number of condition variables created      */
+#endif
+#endif
+
+                                                                        /* READER-WRITER LOCKS ---------------------- */
+#if OS_CFG_RWLOCK_EN > 0u
+#ifndef PKG_USING_UCOSIII_WRAPPER_TINY
+#if OS_CFG_DBG_EN > 0u
+OS_EXT            OS_RWLOCK                *OSRWLockDbgListPtr;
+#endif
+OS_EXT            OS_OBJ_QTY                OSRWLockQty;                /* Number of reader-writer locks created      */
+#endif
 #endif
 
                                                                         /* FLAGS ------------------------------------ */
@@ -946,10 +1296,37 @@ OS_EXT            OS_OBJ_QTY                OSTaskQty;                  /* Numbe
 #if OS_CFG_TASK_REG_TBL_SIZE > 0u
 OS_EXT            OS_REG_ID                 OSTaskRegNextAvailID;       /* Next available Task Register ID            */
 #endif
+#if defined(OS_CFG_TLS_TBL_SIZE) && (OS_CFG_TLS_TBL_SIZE > 0u)
+OS_EXT            OS_TLS_ID                 OS_TLS_NextAvailID;         /* Next available TLS ID                      */
+OS_EXT            OS_TLS_DESTRUCT_PTR       OS_TLS_DestructPtrTbl[OS_CFG_TLS_TBL_SIZE];
+#endif
 #if OS_CFG_SCHED_ROUND_ROBIN_EN > 0u
 OS_EXT            OS_TICK                   OSSchedRoundRobinDfltTimeQuanta;
 OS_EXT            CPU_BOOLEAN               OSSchedRoundRobinEn;        /* Enable/Disable round-robin scheduling      */
 #endif
+#if OS_CFG_TRACE_EN > 0u                                                /* TRACE RECORDER --------------------------- */
+OS_EXT            CPU_BOOLEAN               OSTraceEn;                  /* Enable/Disable trace recording             */
+OS_EXT            CPU_INT32U                OSTraceIx;                  /* Index of the next record to write          */
+OS_EXT            CPU_INT32U                OSTraceCtr;                 /* Total number of records written            */
+#endif
+#if OS_CFG_SCHED_LOCK_TIME_MEAS_EN > 0u                                 /* SCHEDULER LOCK TIME MEASUREMENT ---------- */
+OS_EXT            CPU_TS                    OSSchedLockTimeBegin;       /* Scheduler lock time measurement            */
+OS_EXT            CPU_TS                    OSSchedLockTimeMax;
+OS_EXT            CPU_TS                    OSSchedLockTimeMaxCur;
+OS_EXT            const CPU_CHAR           *OSSchedLockOwnerName;       /* 当前锁定调度器的任务或定时器名称           */
+                                                                        /* 锁定调度器时间最长者的名称                 */
+OS_EXT            CPU_CHAR                  OSSchedLockTimeMaxName[RT_NAME_MAX];
+#endif
+
+#if OS_CFG_ISR_POST_DEFERRED_EN > 0u                                    /* DEFERRED ISR POSTS ----------------------- */
+OS_EXT            OS_INT_Q                 *OSIntQInPtr;
+OS_EXT            OS_INT_Q                 *OSIntQOutPtr;
+OS_EXT            OS_OBJ_QTY                OSIntQNbrEntries;
+OS_EXT            OS_OBJ_QTY                OSIntQNbrEntriesMax;
+OS_EXT            OS_OBJ_QTY                OSIntQOvfCtr;
+OS_EXT            OS_TCB                    OSIntQTaskTCB;
+OS_EXT            CPU_TS                    OSIntQTaskTimeMax;
+#endif
 
 #if OS_CFG_STAT_TASK_EN > 0u
                                                                         /* IDLE TASK -------------------------------- */
@@ -964,6 +1341,17 @@ OS_EXT            OS_TICK                   OSStatTaskCtrMax;
 OS_EXT            OS_TICK                   OSStatTaskCtrRun;
 OS_EXT            CPU_BOOLEAN               OSStatTaskRdy;
 OS_EXT            OS_TCB                    OSStatTaskTCB;
+#if OS_CFG_STAT_TASK_TS_EN > 0u
+OS_EXT            rt_thread_t               OSStatTaskIdlePtr;          /* RT-Thread空闲线程                          */
+OS_EXT            CPU_TS                    OSStatTaskIdleTS;           /* 空闲线程最近一次被切入时的时间戳           */
+OS_EXT            OS_CYCLES                 OSStatTaskIdleCycles;       /* 空闲线程累计运行的时间戳增量               */
+#endif
+#if OS_CFG_DBG_EN > 0u && !defined PKG_USING_UCOSIII_WRAPPER_TINY
+OS_EXT            OS_TCB                   *OSStatTaskTCBCursorPtr;     /* 统计任务下一个要处理的任务                 */
+#if OS_CFG_TMR_EN > 0u
+OS_EXT            OS_TMR                   *OSStatTaskTmrCursorPtr;     /* 统计任务下一个要处理的定时器               */
+#endif
+#endif
 #endif
 
 #if OS_CFG_TMR_EN > 0u                                                  /* TIMERS ----------------------------------- */
@@ -972,6 +1360,9 @@ OS_EXT            OS_TCB                    OSStatTaskTCB;
 OS_EXT            OS_TMR                   *OSTmrDbgListPtr;
 #endif
 OS_EXT            OS_OBJ_QTY                OSTmrQty;                   /* Number of timers created                   */
+OS_EXT            OS_CTR                    OSTmrExpireCtr;             /* 软定时器到期(回调)的总次数                 */
+OS_EXT            OS_CTR                    OSTmrWakeupCtr;             /* 软定时器引起的唤醒次数(同一节拍只算一次)   */
+OS_EXT            rt_tick_t                 OSTmrWakeupTick;            /* 最近一次唤醒的时钟节拍                     */
 #endif
 #endif
 
@@ -995,10 +1386,19 @@ extern  OS_RATE_HZ    const OSCfg_TickRate_Hz;
 extern  OS_RATE_HZ    const OSCfg_TmrTaskRate_Hz;
 #endif
 
+#if (OS_CFG_ISR_POST_DEFERRED_EN > 0u)
+extern  OS_INT_Q       OSCfg_IntQ[];
+extern  CPU_STK        OSCfg_IntQTaskStk[];
+#endif
+
 #if (OS_CFG_STAT_TASK_EN > 0u)
 extern  CPU_STK        OSCfg_StatTaskStk[];
 #endif
 
+#if (OS_CFG_TRACE_EN > 0u)
+extern  OS_TRACE_REC   OSCfg_TraceBuf[];
+#endif
+
 
 /*
 ************************************************************************************************************************
@@ -1088,6 +1488,19 @@ void          OSTaskDel                 (OS_TCB                *p_tcb,
                                          OS_ERR                *p_err);
 #endif
 
+#if OS_CFG_TASK_NOTIFY_EN > 0u
+void          OSTaskNotify              (OS_TCB                *p_tcb,
+                                         OS_NOTIFY_VAL          value,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
+
+void          OSTaskNotifyWait          (OS_NOTIFY_VAL          clear_on_entry,
+                                         OS_NOTIFY_VAL          clear_on_exit,
+                                         OS_NOTIFY_VAL         *p_value,
+                                         OS_TICK                timeout,
+                                         OS_ERR                *p_err);
+#endif
+
 #if OS_CFG_TASK_Q_EN > 0u
 OS_MSG_QTY    OSTaskQFlush              (OS_TCB                *p_tcb,
                                          OS_ERR                *p_err);
@@ -1179,6 +1592,16 @@ void          OS_TaskInit               (OS_ERR                *p_err);
 
 void          OS_TaskInitTCB            (OS_TCB                *p_tcb);
 
+#if OS_CFG_TASK_Q_EN > 0u
+void          OS_TaskQCreate            (OS_TCB                *p_tcb,
+                                         OS_ERR                *p_err);
+#endif
+
+#if OS_CFG_TASK_SEM_EN > 0u
+void          OS_TaskSemCreate          (OS_TCB                *p_tcb,
+                                         OS_ERR                *p_err);
+#endif
+
 
 /* ================================================================================================================== */
 /*                                             MUTUAL EXCLUSION SEMAPHORES                                            */
@@ -1190,6 +1613,13 @@ void          OSMutexCreate             (OS_MUTEX              *p_mutex,
                                          CPU_CHAR              *p_name,
                                          OS_ERR                *p_err);
 
+#if OS_CFG_MUTEX_CEILING_EN > 0u
+void          OSMutexCreateCeiling      (OS_MUTEX              *p_mutex,
+                                         CPU_CHAR              *p_name,
+                                         OS_PRIO                ceiling_prio,
+                                         OS_ERR                *p_err);
+#endif
+
 #if OS_CFG_MUTEX_DEL_EN > 0u
 OS_OBJ_QTY    OSMutexDel                (OS_MUTEX              *p_mutex,
                                          OS_OPT                 opt,
@@ -1224,6 +1654,118 @@ void          OS_MutexDbgListRemove     (OS_MUTEX              *p_mutex);
 
 void          OS_MutexInit              (OS_ERR                *p_err);
 
+#if OS_CFG_MUTEX_PROFILE_EN > 0u
+void          OS_MutexHeldAdd           (OS_MUTEX              *p_mutex,
+                                         OS_TCB                *p_tcb);
+
+void          OS_MutexHeldRemove        (OS_MUTEX              *p_mutex);
+#endif
+
+#if OS_CFG_MUTEX_CEILING_EN > 0u
+void          OS_MutexCeilingAdd        (OS_MUTEX              *p_mutex,
+                                         OS_TCB                *p_tcb,
+                                         OS_PRIO                prio);
+
+OS_PRIO       OS_MutexCeilingRemove     (OS_MUTEX              *p_mutex);
+#endif
+
+#endif
+
+/* ================================================================================================================== */
+/*                                                 CONDITION VARIABLES                                                */
+/* ================================================================================================================== */
+
+#if OS_CFG_COND_EN > 0u
+
+void          OSCondBroadcast           (OS_COND               *p_cond,
+                                         OS_ERR                *p_err);
+
+void          OSCondCreate              (OS_COND               *p_cond,
+                                         CPU_CHAR              *p_name,
+                                         OS_ERR                *p_err);
+
+#if OS_CFG_COND_DEL_EN > 0u
+OS_OBJ_QTY    OSCondDel                 (OS_COND               *p_cond,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
+#endif
+
+void          OSCondSignal              (OS_COND               *p_cond,
+                                         OS_ERR                *p_err);
+
+void          OSCondWait                (OS_COND               *p_cond,
+                                         OS_MUTEX              *p_mutex,
+                                         OS_TICK                timeout,
+                                         OS_ERR                *p_err);
+
+/* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
+
+void          OS_CondClr                (OS_COND               *p_cond);
+
+#if OS_CFG_DBG_EN > 0u && !defined PKG_USING_UCOSIII_WRAPPER_TINY
+void          OS_CondDbgListAdd         (OS_COND               *p_cond);
+
+void          OS_CondDbgListRemove      (OS_COND               *p_cond);
+#endif
+
+void          OS_CondInit               (OS_ERR                *p_err);
+
+#endif
+
+/* ================================================================================================================== */
+/*                                                 READER-WRITER LOCKS                                                */
+/* ================================================================================================================== */
+
+#if OS_CFG_RWLOCK_EN > 0u
+
+void          OSRWLockCreate            (OS_RWLOCK             *p_rwlock,
+                                         CPU_CHAR              *p_name,
+                                         OS_ERR                *p_err);
+
+#if OS_CFG_RWLOCK_DEL_EN > 0u
+OS_OBJ_QTY    OSRWLockDel               (OS_RWLOCK             *p_rwlock,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
+#endif
+
+#if OS_CFG_RWLOCK_PEND_ABORT_EN > 0u
+OS_OBJ_QTY    OSRWLockPendAbort         (OS_RWLOCK             *p_rwlock,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
+#endif
+
+void          OSRWLockReadPend          (OS_RWLOCK             *p_rwlock,
+                                         OS_TICK                timeout,
+                                         OS_OPT                 opt,
+                                         CPU_TS                *p_ts,
+                                         OS_ERR                *p_err);
+
+void          OSRWLockReadPost          (OS_RWLOCK             *p_rwlock,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
+
+void          OSRWLockWritePend         (OS_RWLOCK             *p_rwlock,
+                                         OS_TICK                timeout,
+                                         OS_OPT                 opt,
+                                         CPU_TS                *p_ts,
+                                         OS_ERR                *p_err);
+
+void          OSRWLockWritePost         (OS_RWLOCK             *p_rwlock,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
+
+/* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
+
+void          OS_RWLockClr              (OS_RWLOCK             *p_rwlock);
+
+#if OS_CFG_DBG_EN > 0u && !defined PKG_USING_UCOSIII_WRAPPER_TINY
+void          OS_RWLockDbgListAdd       (OS_RWLOCK             *p_rwlock);
+
+void          OS_RWLockDbgListRemove    (OS_RWLOCK             *p_rwlock);
+#endif
+
+void          OS_RWLockInit             (OS_ERR                *p_err);
+
 #endif
 
 /* ================================================================================================================== */
@@ -1237,6 +1779,21 @@ void          OSQCreate                 (OS_Q                  *p_q,
                                          OS_MSG_QTY             max_qty,
                                          OS_ERR                *p_err);
 
+void          OSQCreateStatic           (OS_Q                  *p_q,
+                                         CPU_CHAR              *p_name,
+                                         void                  *p_storage,
+                                         OS_MSG_QTY             max_qty,
+                                         OS_ERR                *p_err);
+
+#if OS_CFG_Q_COPY_EN > 0u
+void          OSQCreateCopy             (OS_Q                  *p_q,
+                                         CPU_CHAR              *p_name,
+                                         void                  *p_storage,
+                                         OS_MSG_QTY             max_qty,
+                                         OS_MSG_SIZE            msg_size,
+                                         OS_ERR                *p_err);
+#endif
+
 #if OS_CFG_Q_DEL_EN > 0u
 OS_OBJ_QTY    OSQDel                    (OS_Q                  *p_q,
                                          OS_OPT                 opt,
@@ -1267,10 +1824,43 @@ void          OSQPost                   (OS_Q                  *p_q,
                                          OS_OPT                 opt,
                                          OS_ERR                *p_err);
 
+#if OS_CFG_Q_PRIO_EN > 0u
+void          OSQPostPrio               (OS_Q                  *p_q,
+                                         void                  *p_void,
+                                         OS_MSG_SIZE            msg_size,
+                                         OS_PRIO                prio,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
+#endif
+
+#if OS_CFG_Q_COPY_EN > 0u
+void          OSQPendCopy               (OS_Q                  *p_q,
+                                         void                  *p_buf,
+                                         OS_MSG_SIZE            buf_size,
+                                         OS_TICK                timeout,
+                                         OS_OPT                 opt,
+                                         OS_MSG_SIZE           *p_msg_size,
+                                         CPU_TS                *p_ts,
+                                         OS_ERR                *p_err);
+
+void          OSQPostCopy               (OS_Q                  *p_q,
+                                         void                  *p_void,
+                                         OS_MSG_SIZE            msg_size,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
+#endif
+
 /* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
 
 void          OS_QClr                   (OS_Q                  *p_q);
 
+#if OS_CFG_Q_PRIO_EN > 0u
+rt_err_t      OS_QPrioPost              (OS_Q                  *p_q,
+                                         ucos_msg_t            *p_msg,
+                                         OS_PRIO                prio,
+                                         OS_OPT                 opt);
+#endif
+
 #if OS_CFG_DBG_EN > 0u && !defined PKG_USING_UCOSIII_WRAPPER_TINY
 void          OS_QDbgListAdd            (OS_Q                  *p_q);
 
@@ -1367,9 +1957,68 @@ void          OSStatReset               (OS_ERR                *p_err);
 void          OSStatTaskCPUUsageInit    (OS_ERR                *p_err);
 #endif
 
+#if OS_CFG_TRACE_EN > 0u
+void          OSTraceClr                (void);
+
+void          OSTraceEnable             (CPU_BOOLEAN            en);
+#endif
+
 CPU_INT16U    OSVersion                 (OS_ERR                *p_err);
 
 /* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
+#if OS_CFG_ISR_POST_DEFERRED_EN > 0u
+void          OS_IntQTaskInit           (OS_ERR                *p_err);
+
+void          OS_IntQPost               (OS_OBJ_TYPE            type,
+                                         void                  *p_obj,
+                                         void                  *p_void,
+                                         OS_MSG_SIZE            msg_size,
+                                         OS_FLAGS               flags,
+                                         OS_PRIO                prio,
+                                         OS_OPT                 opt,
+                                         CPU_TS                 ts,
+                                         OS_ERR                *p_err);
+
+void          OS_IntQRePost             (void);
+
+void          OS_IntQTask               (void                  *p_arg);
+#endif
+
+#if OS_CFG_TS_EN > 0u
+CPU_TS        OS_PostTS                 (void);
+#endif
+
+#if OS_CFG_TRACE_EN > 0u
+void          OS_TraceInit              (void);
+
+void          OS_TraceName              (void                  *p_obj,
+                                         const CPU_CHAR        *p_name);
+
+void          OS_TraceRec               (CPU_INT16U             event,
+                                         void                  *p_obj,
+                                         CPU_INT32U             arg);
+
+void          OS_TraceTaskSw            (rt_thread_t            from,
+                                         rt_thread_t            to);
+#endif
+
+#if OS_CFG_OBJ_STAT_EN > 0u
+void          OS_ObjStatClr             (OS_OBJ_STAT           *p_stat);
+
+OS_TICK       OS_ObjStatPendBlock       (OS_OBJ_STAT           *p_stat);
+
+void          OS_ObjStatPendEnd         (OS_OBJ_STAT           *p_stat,
+                                         OS_TICK                start,
+                                         OS_TCB                *p_tcb,
+                                         OS_ERR                 err);
+#endif
+
+#if OS_CFG_SCHED_LOCK_TIME_MEAS_EN > 0u
+void          OS_SchedLockTimeMeasStart (void);
+void          OS_SchedLockTimeMeasStop  (void);
+void          OS_SchedLockOwnerSet      (const CPU_CHAR        *p_name);
+#endif
+
 #if OS_CFG_STAT_TASK_EN > 0u
 void          OS_IdleTask               (void);
 void          OS_IdleTaskInit           (OS_ERR                *p_err);
@@ -1450,6 +2099,15 @@ void          OSTmrCreate               (OS_TMR                *p_tmr,
                                          void                  *p_callback_arg,
                                          OS_ERR                *p_err);
 
+void          OSTmrCreateHard           (OS_TMR                *p_tmr,
+                                         CPU_CHAR              *p_name,
+                                         OS_TICK                dly,
+                                         OS_TICK                period,
+                                         OS_OPT                 opt,
+                                         OS_TMR_HARD_CALLBACK_PTR p_callback,
+                                         void                  *p_callback_arg,
+                                         OS_ERR                *p_err);
+
 CPU_BOOLEAN   OSTmrDel                  (OS_TMR                *p_tmr,
                                          OS_ERR                *p_err);
 
@@ -1463,6 +2121,12 @@ void          OSTmrSet                  (OS_TMR                *p_tmr,
                                          void                  *p_callback_arg,
                                          OS_ERR                *p_err);
 
+#if OS_CFG_TMR_SLACK_EN > 0u
+void          OSTmrSlackSet             (OS_TMR                *p_tmr,
+                                         OS_TICK                slack,
+                                         OS_ERR                *p_err);
+#endif
+
 CPU_BOOLEAN   OSTmrStart                (OS_TMR                *p_tmr,
                                          OS_ERR                *p_err);
 
@@ -1508,6 +2172,18 @@ void          OSMemPut                  (OS_MEM                *p_mem,
                                          void                  *p_blk,
                                          OS_ERR                *p_err);
 
+OS_MEM_QTY    OSMemGetN                 (OS_MEM                *p_mem,
+                                         void                 **p_blks,
+                                         OS_MEM_QTY             n_blks,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
+
+OS_MEM_QTY    OSMemPutN                 (OS_MEM                *p_mem,
+                                         void                 **p_blks,
+                                         OS_MEM_QTY             n_blks,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
+
 /* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
 
 #if OS_CFG_DBG_EN > 0u
@@ -1533,6 +2209,13 @@ void          OSTaskCreateHook          (OS_TCB                *p_tcb);
 void          OSTaskDelHook             (OS_TCB                *p_tcb);
 void          OSIdleTaskHook            (void);
 void          OSStatTaskHook            (void);
+#if OS_CFG_TASK_STK_CANARY_EN > 0u
+void          OSTaskStkOvfHook          (OS_TCB                *p_tcb);
+#endif
+#if OS_TASK_SW_HOOK_EN > 0u
+void          OSTaskSwHook              (rt_thread_t            from,
+                                         rt_thread_t            to);
+#endif
 
 /*
 ************************************************************************************************************************
@@ -1559,6 +2242,7 @@ void          OS_Dbg_Init               (void);
 OS_ERR        rt_err_to_ucosiii         (rt_err_t rt_err);
 rt_err_t      rt_ipc_pend_abort_1       (rt_list_t *list);
 rt_uint16_t   rt_ipc_pend_abort_all     (rt_list_t *list);
+void          rt_ipc_list_insert_prio   (rt_list_t *list, struct rt_thread *thread);
 rt_err_t      rt_sem_release_all        (rt_sem_t sem);
 rt_err_t      rt_mq_send_all            (rt_mq_t mq, void *buffer, rt_size_t size);
 
@@ -1631,6 +2315,26 @@ rt_err_t      rt_mq_send_all            (rt_mq_t mq, void *buffer, rt_size_t siz
 #endif
 
 
+#ifndef OS_CFG_ISR_POST_DEFERRED_EN
+#error  "OS_CFG.H, Missing OS_CFG_ISR_POST_DEFERRED_EN: Enable (1) or Disable (0) Deferred ISR posts"
+#else
+    #if OS_CFG_ISR_POST_DEFERRED_EN > 0u
+        #ifndef OS_CFG_INT_Q_SIZE
+        #error  "OS_CFG_APP.H, Missing OS_CFG_INT_Q_SIZE: Size of ISR handler task queue"
+        #endif
+
+        #ifndef OS_CFG_INT_Q_TASK_STK_SIZE
+        #error  "OS_CFG_APP.H, Missing OS_CFG_INT_Q_TASK_STK_SIZE: Stack size of ISR handler task"
+        #endif
+    #endif
+#endif
+
+
+#ifndef OS_CFG_TS_EN
+#error  "OS_CFG.H, Missing OS_CFG_TS_EN: Enable (1) or Disable (0) time stamping"
+#endif
+
+
 #ifndef OS_CFG_OBJ_TYPE_CHK_EN
 #error  "OS_CFG.H, Missing OS_CFG_OBJ_TYPE_CHK_EN: Enable (1) or Disable (0) checking for proper object types in kernel services"
 #endif
@@ -1641,6 +2345,27 @@ rt_err_t      rt_mq_send_all            (rt_mq_t mq, void *buffer, rt_size_t siz
 #endif
 
 
+#ifndef OS_CFG_SCHED_LOCK_TIME_MEAS_EN
+#error  "OS_CFG.H, Missing OS_CFG_SCHED_LOCK_TIME_MEAS_EN: Include code to measure scheduler lock time"
+#endif
+
+
+#ifndef OS_CFG_TRACE_EN
+#error  "OS_CFG.H, Missing OS_CFG_TRACE_EN: Enable (1) or Disable (0) the binary kernel event trace recorder"
+#else
+    #if OS_CFG_TRACE_EN > 0u
+        #ifndef OS_CFG_TRACE_BUF_SIZE
+        #error  "OS_CFG_APP.H, Missing OS_CFG_TRACE_BUF_SIZE: Number of records in the trace ring buffer"
+        #endif
+    #endif
+#endif
+
+
+#ifndef OS_CFG_OBJ_STAT_EN
+#error  "OS_CFG.H, Missing OS_CFG_OBJ_STAT_EN: Enable (1) or Disable (0) per-object contention statistics"
+#endif
+
+
 #ifndef OS_CFG_STK_SIZE_MIN
 #error  "OS_CFG.H, Missing OS_CFG_STK_SIZE_MIN: Determines the minimum size for a task stack"
 #endif
@@ -1694,6 +2419,50 @@ rt_err_t      rt_mq_send_all            (rt_mq_t mq, void *buffer, rt_size_t siz
     #ifndef OS_CFG_MUTEX_PEND_ABORT_EN
     #error  "OS_CFG.H, Missing OS_CFG_MUTEX_PEND_ABORT_EN: Include code for OSMutexPendAbort()"
     #endif
+
+    #ifndef OS_CFG_MUTEX_PROFILE_EN
+    #error  "OS_CFG.H, Missing OS_CFG_MUTEX_PROFILE_EN: Include code to profile mutex hold time and priority inheritance"
+    #endif
+
+    #ifndef OS_CFG_MUTEX_CEILING_EN
+    #error  "OS_CFG.H, Missing OS_CFG_MUTEX_CEILING_EN: Include code for OSMutexCreateCeiling()"
+    #endif
+#endif
+
+/*
+************************************************************************************************************************
+*                                                 CONDITION VARIABLES
+************************************************************************************************************************
+*/
+
+#ifndef OS_CFG_COND_EN
+#error  "OS_CFG.H, Missing OS_CFG_COND_EN: Enable (1) or Disable (0) code generation for CONDITION VARIABLES"
+#else
+    #ifndef OS_CFG_COND_DEL_EN
+    #error  "OS_CFG.H, Missing OS_CFG_COND_DEL_EN: Include code for OSCondDel()"
+    #endif
+
+    #if (OS_CFG_COND_EN > 0u) && (OS_CFG_MUTEX_EN == 0u)
+    #error  "OS_CFG.H, OS_CFG_COND_EN requires OS_CFG_MUTEX_EN"
+    #endif
+#endif
+
+/*
+************************************************************************************************************************
+*                                                 READER-WRITER LOCKS
+************************************************************************************************************************
+*/
+
+#ifndef OS_CFG_RWLOCK_EN
+#error  "OS_CFG.H, Missing OS_CFG_RWLOCK_EN: Enable (1) or Disable (0) code generation for READER-WRITER LOCKS"
+#else
+    #ifndef OS_CFG_RWLOCK_DEL_EN
+    #error  "OS_CFG.H, Missing OS_CFG_RWLOCK_DEL_EN: Include code for OSRWLockDel()"
+    #endif
+
+    #ifndef OS_CFG_RWLOCK_PEND_ABORT_EN
+    #error  "OS_CFG.H, Missing OS_CFG_RWLOCK_PEND_ABORT_EN: Include code for OSRWLockPendAbort()"
+    #endif
 #endif
 
 /*
@@ -1716,6 +2485,22 @@ rt_err_t      rt_mq_send_all            (rt_mq_t mq, void *buffer, rt_size_t siz
     #ifndef OS_CFG_Q_PEND_ABORT_EN
     #error  "OS_CFG.H, Missing OS_CFG_Q_PEND_ABORT_EN: Include code for OSQPendAbort()"
     #endif
+
+    #ifndef OS_CFG_Q_COPY_EN
+    #error  "OS_CFG.H, Missing OS_CFG_Q_COPY_EN: Include code for OSQCreateCopy(), OSQPostCopy() and OSQPendCopy()"
+    #endif
+
+    #ifndef OS_CFG_Q_PRIO_EN
+    #error  "OS_CFG.H, Missing OS_CFG_Q_PRIO_EN: Include code for OSQPostPrio()"
+    #else
+        #if OS_CFG_Q_PRIO_EN > 0u
+            #ifndef OS_CFG_Q_PRIO_LEVELS
+            #error  "OS_CFG.H, Missing OS_CFG_Q_PRIO_LEVELS: Number of message priority levels for OSQPostPrio()"
+            #elif (OS_CFG_Q_PRIO_LEVELS < 1u) || (OS_CFG_Q_PRIO_LEVELS > 32u)
+            #error  "OS_CFG.H, OS_CFG_Q_PRIO_LEVELS must be between 1 and 32"
+            #endif
+        #endif
+    #endif
 #endif
 
 /*
@@ -1754,6 +2539,35 @@ rt_err_t      rt_mq_send_all            (rt_mq_t mq, void *buffer, rt_size_t siz
 #error  "OS_CFG.H, Missing OS_CFG_STAT_TASK_STK_CHK_EN: Check task stacks from statistics task"
 #endif
 
+#if OS_CFG_STAT_TASK_EN > 0u
+    #ifndef OS_CFG_STAT_TASK_SWEEP_PERIODS
+    #error  "OS_CFG_APP.H, Missing OS_CFG_STAT_TASK_SWEEP_PERIODS: Number of statistic periods per sweep of tasks and timers"
+    #else
+        #if OS_CFG_STAT_TASK_SWEEP_PERIODS < 1u
+        #error  "OS_CFG_APP.H, OS_CFG_STAT_TASK_SWEEP_PERIODS must be >= 1"
+        #endif
+    #endif
+#endif
+
+#ifndef OS_CFG_STAT_TASK_TS_EN
+#error  "OS_CFG.H, Missing OS_CFG_STAT_TASK_TS_EN: Measure CPU usage from idle time stamps"
+#else
+    #if (OS_CFG_STAT_TASK_TS_EN > 0u) && !defined RT_USING_HOOK
+    #error  "OS_CFG.H, OS_CFG_STAT_TASK_TS_EN requires RT_USING_HOOK"
+    #endif
+#endif
+
+#ifndef OS_CFG_TASK_STK_CANARY_EN
+#error  "OS_CFG.H, Missing OS_CFG_TASK_STK_CANARY_EN: Check the stack canary of each task on context switch"
+#else
+    #if (OS_CFG_TASK_PROFILE_EN > 0u) && !defined RT_USING_HOOK
+    #error  "OS_CFG.H, OS_CFG_TASK_PROFILE_EN requires RT_USING_HOOK"
+    #endif
+    #if (OS_CFG_TASK_STK_CANARY_EN > 0u) && !defined RT_USING_HOOK
+    #error  "OS_CFG.H, OS_CFG_TASK_STK_CANARY_EN requires RT_USING_HOOK"
+    #endif
+#endif
+
 #ifndef OS_CFG_TASK_CHANGE_PRIO_EN
 #error  "OS_CFG.H, Missing OS_CFG_TASK_CHANGE_PRIO_EN: Include code for OSTaskChangePrio()"
 #endif
@@ -1762,6 +2576,10 @@ rt_err_t      rt_mq_send_all            (rt_mq_t mq, void *buffer, rt_size_t siz
 #error  "OS_CFG.H, Missing OS_CFG_TASK_DEL_EN: Include code for OSTaskDel()"
 #endif
 
+#ifndef OS_CFG_TASK_NOTIFY_EN
+#error  "OS_CFG.H, Missing OS_CFG_TASK_NOTIFY_EN: Include code for OSTaskNotify() and OSTaskNotifyWait()"
+#endif
+
 #ifndef OS_CFG_TASK_Q_EN
 #error  "OS_CFG.H, Missing OS_CFG_TASK_Q_EN: Include code for OSTaskQxxx()"
 #endif
@@ -1826,6 +2644,10 @@ rt_err_t      rt_mq_send_all            (rt_mq_t mq, void *buffer, rt_size_t siz
     #ifndef OS_CFG_TMR_DEL_EN
     #error  "OS_CFG.H, Missing OS_CFG_TMR_DEL_EN: Enables (1) or Disables (0) code for OSTmrDel()"
     #endif
+
+    #ifndef OS_CFG_TMR_SLACK_EN
+    #error  "OS_CFG.H, Missing OS_CFG_TMR_SLACK_EN: Enables (1) or Disables (0) timer slack coalescing"
+    #endif
 #endif
 #endif
 
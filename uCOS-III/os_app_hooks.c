@@ -77,6 +77,9 @@ void  App_OS_SetAllHooks (void)
     CPU_CRITICAL_ENTER();
     OS_AppTaskCreateHookPtr = App_OS_TaskCreateHook;
     OS_AppTaskDelHookPtr    = App_OS_TaskDelHook;
+#if OS_CFG_TASK_STK_CANARY_EN > 0u
+    OS_AppTaskStkOvfHookPtr = App_OS_TaskStkOvfHook;
+#endif
 #if OS_CFG_STAT_TASK_EN > 0u
     OS_AppIdleTaskHookPtr   = App_OS_IdleTaskHook;
     OS_AppStatTaskHookPtr   = App_OS_StatTaskHook;
@@ -105,6 +108,9 @@ void  App_OS_ClrAllHooks (void)
     CPU_CRITICAL_ENTER();
     OS_AppTaskCreateHookPtr = (OS_APP_HOOK_TCB)0;
     OS_AppTaskDelHookPtr    = (OS_APP_HOOK_TCB)0;
+#if OS_CFG_TASK_STK_CANARY_EN > 0u
+    OS_AppTaskStkOvfHookPtr = (OS_APP_HOOK_TCB)0;
+#endif
 #if OS_CFG_STAT_TASK_EN > 0u
     OS_AppIdleTaskHookPtr   = (OS_APP_HOOK_VOID)0;
     OS_AppStatTaskHookPtr   = (OS_APP_HOOK_VOID)0;
@@ -149,6 +155,26 @@ void  App_OS_TaskDelHook (OS_TCB  *p_tcb)
 
 }
 
+/*
+************************************************************************************************************************
+*                                         APPLICATION TASK STACK OVERFLOW HOOK
+*
+* Description: This function is called when the stack canary of a task is found to be overwritten.
+*
+* Arguments  : p_tcb   is a pointer to the task control block of the task whose stack overflowed.
+*
+* Note(s)    : 1) 在RT-Thread调度器中关中断调用,不能调用会引起阻塞或调度的函数.
+************************************************************************************************************************
+*/
+
+#if OS_CFG_TASK_STK_CANARY_EN > 0u
+void  App_OS_TaskStkOvfHook (OS_TCB  *p_tcb)
+{
+    CPU_VAL_UNUSED(p_tcb);
+
+}
+#endif
+
 /*
 ************************************************************************************************************************
 *                                              APPLICATION IDLE TASK HOOK
@@ -84,6 +84,9 @@ void  App_OS_ClrAllHooks   (void);
                                                                 /* ---------------------- HOOKS --------------------- */
 void  App_OS_TaskCreateHook(OS_TCB  *p_tcb);
 void  App_OS_TaskDelHook   (OS_TCB  *p_tcb);
+#if OS_CFG_TASK_STK_CANARY_EN > 0u
+void  App_OS_TaskStkOvfHook(OS_TCB  *p_tcb);
+#endif
 #if OS_CFG_STAT_TASK_EN > 0u
 void  App_OS_IdleTaskHook  (void);
 void  App_OS_StatTaskHook  (void);
@@ -74,11 +74,16 @@
 #define  OS_CFG_ARG_CHK_EN               1u                 /* Enable (1) or Disable (0) argument checking                           */
 #define  OS_CFG_CALLED_FROM_ISR_CHK_EN   1u                 /* Enable (1) or Disable (0) check for called from ISR                   */
 #define  OS_CFG_DBG_EN                   1u                 /* Enable (1) debug code/variables                                       */
+#define  OS_CFG_ISR_POST_DEFERRED_EN     0u                 /* Enable (1) or Disable (0) Deferred ISR posts                          */
 #define  OS_CFG_INVALID_OS_CALLS_CHK_EN  1u                 /* Enable (1) or Disable (0) checks for invalid kernel calls             */
 #define  OS_CFG_OBJ_TYPE_CHK_EN          1u                 /* Enable (1) or Disable (0) object type checking                        */
 #define  OS_CFG_PEND_MULTI_EN            0u                 /* 只读,Enable (1) or Disable (0) code generation for multi-pend feature */
+#define  OS_CFG_TS_EN                    0u                 /* Enable (1) or Disable (0) time stamping                               */
 #define  OS_CFG_PRIO_MAX        RT_THREAD_PRIORITY_MAX      /* 只读 Defines the maximum number of task priorities                    */
 #define  OS_CFG_SCHED_ROUND_ROBIN_EN     1u                 /* 只读,RTT时间片轮转为必选项 Include code for Round-Robin scheduling    */
+#define  OS_CFG_SCHED_LOCK_TIME_MEAS_EN  0u                 /* Include code to measure scheduler lock time                           */
+#define  OS_CFG_TRACE_EN                 0u                 /* Enable (1) or Disable (0) the binary kernel event trace recorder      */
+#define  OS_CFG_OBJ_STAT_EN              0u                 /* Enable (1) or Disable (0) per-object contention statistics            */
 #define  OS_CFG_STK_SIZE_MIN            64u                 /* Minimum allowable task stack size                                     */
 
 
@@ -105,6 +110,19 @@
 #endif
 #define  OS_CFG_MUTEX_DEL_EN             1u                 /* Include code for OSMutexDel()                                         */
 #define  OS_CFG_MUTEX_PEND_ABORT_EN      1u                 /* Include code for OSMutexPendAbort()                                   */
+#define  OS_CFG_MUTEX_PROFILE_EN         0u                 /* Include code to profile mutex hold time and priority inheritance      */
+#define  OS_CFG_MUTEX_CEILING_EN         0u                 /* Include code for OSMutexCreateCeiling() (immediate priority ceiling)  */
+
+
+                                                            /* ------------------------- CONDITION VARIABLES ----------------------- */
+#define  OS_CFG_COND_EN                  0u                 /* Enable (1) or Disable (0) code generation for CONDITION VARIABLES     */
+#define  OS_CFG_COND_DEL_EN              1u                 /* Include code for OSCondDel()                                          */
+
+
+                                                            /* ------------------------- READER-WRITER LOCKS ----------------------- */
+#define  OS_CFG_RWLOCK_EN                0u                 /* Enable (1) or Disable (0) code generation for READER-WRITER LOCKS     */
+#define  OS_CFG_RWLOCK_DEL_EN            1u                 /* Include code for OSRWLockDel()                                        */
+#define  OS_CFG_RWLOCK_PEND_ABORT_EN     1u                 /* Include code for OSRWLockPendAbort()                                  */
 
 
                                                             /* --------------------------- MESSAGE QUEUES -------------------------- */
@@ -116,6 +134,9 @@
 #define  OS_CFG_Q_DEL_EN                 1u                 /* Include code for OSQDel()                                             */
 #define  OS_CFG_Q_FLUSH_EN               1u                 /* Include code for OSQFlush()                                           */
 #define  OS_CFG_Q_PEND_ABORT_EN          1u                 /* Include code for OSQPendAbort()                                       */
+#define  OS_CFG_Q_COPY_EN                0u                 /* Include code for OSQCreateCopy(), OSQPostCopy() and OSQPendCopy()     */
+#define  OS_CFG_Q_PRIO_EN                0u                 /* Include code for OSQPostPrio()                                        */
+#define  OS_CFG_Q_PRIO_LEVELS            4u                 /* Number of message priority levels for OSQPostPrio() (1 to 32)         */
 
 
                                                             /* ----------------------------- SEMAPHORES ---------------------------- */
@@ -132,15 +153,18 @@
                                                             /* -------------------------- TASK MANAGEMENT -------------------------- */
 #define  OS_CFG_STAT_TASK_EN             1u                 /* Enable (1) or Disable(0) the statistics task                          */
 #define  OS_CFG_STAT_TASK_STK_CHK_EN     1u                 /* Check task stacks from statistic task                                 */
+#define  OS_CFG_STAT_TASK_TS_EN          0u                 /* 需RT_USING_HOOK,以空闲线程时间戳测量CPU使用率,无需启动校准            */
 
 #define  OS_CFG_TASK_CHANGE_PRIO_EN      1u                 /* Include code for OSTaskChangePrio()                                   */
 #define  OS_CFG_TASK_DEL_EN              1u                 /* Include code for OSTaskDel()                                          */
+#define  OS_CFG_TASK_NOTIFY_EN           0u                 /* Include code for OSTaskNotify() and OSTaskNotifyWait()                */
 #define  OS_CFG_TASK_SEM_EN              1u                 /* Include code for OSTaskSemXXXX()                                      */
 #define  OS_CFG_TASK_Q_EN                1u                 /* Include code for OSTaskQXXXX()                                        */
 #define  OS_CFG_TASK_Q_PEND_ABORT_EN     1u                 /* Include code for OSTaskQPendAbort()                                   */
-#define  OS_CFG_TASK_PROFILE_EN          0u                 /* 只读 Include variables in OS_TCB for profiling                        */
+#define  OS_CFG_TASK_PROFILE_EN          0u                 /* 需RT_USING_HOOK,会占用RTT调度器钩子,统计任务运行时间                  */
 #define  OS_CFG_TASK_REG_TBL_SIZE        1u                 /* Number of task specific registers                                     */
 #define  OS_CFG_TASK_SEM_PEND_ABORT_EN   1u                 /* Include code for OSTaskSemPendAbort()                                 */
+#define  OS_CFG_TASK_STK_CANARY_EN       0u                 /* 需RT_USING_HOOK,任务切出时检查栈末端的金丝雀字,发现溢出立即调用钩子   */
 #define  OS_CFG_TASK_SUSPEND_EN          1u                 /* Include code for OSTaskSuspend() and OSTaskResume()                   */
 
 
@@ -150,7 +174,7 @@
 
 
                                                             /* ------------------- TASK LOCAL STORAGE MANAGEMENT ------------------- */
-#define  OS_CFG_TLS_TBL_SIZE             0u                 /* 只读,该功能尚未实现 Include code for Task Local Storage (TLS) registers*/
+#define  OS_CFG_TLS_TBL_SIZE             0u                 /* Include code for Task Local Storage (TLS) registers                   */
 
 
                                                             /* ------------------------- TIMER MANAGEMENT -------------------------- */
@@ -160,6 +184,7 @@
 #define  OS_CFG_TMR_EN                   0u                 /* 只读 Enable (1) or Disable (0) code generation for TIMERS             */
 #endif
 #define  OS_CFG_TMR_DEL_EN               1u                 /* Enable (1) or Disable (0) code generation for OSTmrDel()              */
+#define  OS_CFG_TMR_SLACK_EN             0u                 /* Enable (1) or Disable (0) 定时器松弛合并及OSTmrSlackSet()             */
 
 
 #ifdef   OS_SAFETY_CRITICAL
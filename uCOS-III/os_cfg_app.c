@@ -66,10 +66,19 @@
 *                                                    DATA STORAGE
 ************************************************************************************************************************
 */
+#if (OS_CFG_ISR_POST_DEFERRED_EN > 0u)
+OS_INT_Q       OSCfg_IntQ          [OS_CFG_INT_Q_SIZE];
+CPU_STK        OSCfg_IntQTaskStk   [OS_CFG_INT_Q_TASK_STK_SIZE];
+#endif
+
 #if (OS_CFG_STAT_TASK_EN > 0u)
 CPU_STK        OSCfg_StatTaskStk   [OS_CFG_STAT_TASK_STK_SIZE];
 #endif
 
+#if (OS_CFG_TRACE_EN > 0u)
+OS_TRACE_REC   OSCfg_TraceBuf      [OS_CFG_TRACE_BUF_SIZE];
+#endif
+
 #ifndef PKG_USING_UCOSIII_WRAPPER_TINY
 #if OS_CFG_DBG_EN > 0u
 /*
@@ -116,10 +125,17 @@ OS_RATE_HZ     const  OSCfg_TmrTaskRate_Hz       = (OS_RATE_HZ  )0;
 */
 
 CPU_INT32U     const  OSCfg_DataSizeRAM          =
+#if (OS_CFG_ISR_POST_DEFERRED_EN > 0u)
+                                                 + sizeof(OSCfg_IntQ)
+                                                 + sizeof(OSCfg_IntQTaskStk)
+#endif
 #if (OS_CFG_STAT_TASK_EN > 0u)
                                                  + sizeof(OSCfg_StatTaskStk)
 #else
                                                  + 0
+#endif
+#if (OS_CFG_TRACE_EN > 0u)
+                                                 + sizeof(OSCfg_TraceBuf)
 #endif
                                                  ;
 
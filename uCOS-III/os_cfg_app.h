@@ -68,10 +68,18 @@
 #define  OS_CFG_TASK_STK_LIMIT_PCT_EMPTY  10u               /* 只读 Stack limit position in percentage to empty       */
 #define  OS_CFG_STAT_TASK_STK_LIMIT      ((OS_CFG_STAT_TASK_STK_SIZE  * OS_CFG_TASK_STK_LIMIT_PCT_EMPTY) / 100u)
 
+                                                            /* ------------------ ISR HANDLER TASK ------------------ */
+#define  OS_CFG_INT_Q_SIZE                10u               /* Size of ISR handler task queue                         */
+#define  OS_CFG_INT_Q_TASK_STK_SIZE      128u               /* Stack size (number of CPU_STK elements)                */
+
+                                                            /* -------------------- TRACE RECORDER ------------------ */
+#define  OS_CFG_TRACE_BUF_SIZE           256u               /* Number of records in the trace ring buffer             */
+
                                                             /* ------------------- STATISTIC TASK ------------------- */
 #define  OS_CFG_STAT_TASK_PRIO      (OS_CFG_PRIO_MAX-2u)    /* 只读 统计任务优先级总是为OS_CFG_PRIO_MAX-2             */
 #define  OS_CFG_STAT_TASK_RATE_HZ         10u               /* Rate of execution (1 to 10 Hz)                         */
 #define  OS_CFG_STAT_TASK_STK_SIZE       128u               /* Stack size (number of CPU_STK elements)                */
+#define  OS_CFG_STAT_TASK_SWEEP_PERIODS    1u               /* 在几个统计周期内遍历完全部任务和定时器(1:每周期全部)   */
 
                                                             /* ----------------------- TIMERS ----------------------- */
 #define  OS_CFG_TMR_TASK_PRIO        RT_TIMER_THREAD_PRIO   /* 只读 Priority of 'Timer Task' 定时任务优先级           */
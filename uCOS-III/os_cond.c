@@ -0,0 +1,833 @@
+/*
+ * Copyright (c) 2021, Meco Jianting Man <jiantingman@foxmail.com>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2026-10-19     agent        implement condition variables
+ */
+/*
+************************************************************************************************************************
+*                                                      uC/OS-III
+*                                                 The Real-Time Kernel
+*
+*                                             CONDITION VARIABLE MANAGEMENT
+*
+* File    : OS_COND.C
+* Version : V3.03.00
+************************************************************************************************************************
+* Note(s)    : 1) 条件变量与OS_MUTEX配合使用.RT-Thread没有条件变量对象,等待的任务挂在条件变量自己的按优先级排列的
+*                 等待链表上,阻塞与超时使用线程自带的定时器(参见OSTaskNotifyWait()).
+*
+*              2) OSCondWait()在锁调度器的情况下释放互斥量并进入等待链表,二者之间不会发生任务切换,因此持有互斥量
+*                 的任务发出的OSCondSignal()/OSCondBroadcast()不会丢失.
+*
+*              3) 互斥量被其他任务持有时(通常是发出通知的任务自己),OSCondSignal()/OSCondBroadcast()不唤醒等待者,
+*                 而是将其直接移到互斥量的等待链表上(与rt_mutex_take()一样按优先级插入并进行优先级继承),互斥量被
+*                 释放时由rt_mutex_release()逐个交给它们.这样OSCondBroadcast()不会一次唤醒所有等待者去竞争互斥量.
+*                 使用天花板协议的互斥量(参见OSMutexCreateCeiling())没有这个优化,等待者被唤醒后调用OSMutexPend().
+*
+*              4) 等待同一个条件变量的任务必须使用同一个互斥量.
+************************************************************************************************************************
+*/
+
+#include "os.h"
+
+#if OS_CFG_COND_EN > 0u
+static  CPU_BOOLEAN  OS_CondWake      (OS_COND           *p_cond,
+                                       struct rt_thread  *thread);
+
+#if OS_CFG_DBG_EN > 0u && !defined PKG_USING_UCOSIII_WRAPPER_TINY
+static  void         OS_CondDbgNameUpd(OS_COND           *p_cond);
+#endif
+
+/*
+************************************************************************************************************************
+*                                       BROADCAST A SIGNAL TO A CONDITION VARIABLE
+*
+* Description: This function signals all the tasks waiting on a condition variable.
+*
+* Arguments  : p_cond    is a pointer to the condition variable
+*
+*              p_err     is a pointer to a variable that will contain an error code returned by this function.
+*
+*                            OS_ERR_NONE             The call was successful
+*                            OS_ERR_OBJ_PTR_NULL     If 'p_cond' is a NULL pointer.
+*                            OS_ERR_OBJ_TYPE         If 'p_cond' is not pointing at a condition variable
+*                            OS_ERR_OS_NOT_RUNNING   If uC/OS-III is not running yet
+*                            OS_ERR_POST_ISR         If you attempted to call this function from an ISR
+*
+* Returns    : none
+*
+* Note(s)    : 1) 互斥量被持有时,所有等待者被移到互斥量的等待链表上,随后逐个获得互斥量(参见文件头Note(s) #3).
+************************************************************************************************************************
+*/
+
+void  OSCondBroadcast (OS_COND  *p_cond,
+                       OS_ERR   *p_err)
+{
+    struct rt_thread  *thread;
+    CPU_BOOLEAN        readied;
+
+    CPU_SR_ALLOC();
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u
+    if(OSIntNestingCtr > (OS_NESTING_CTR)0)                 /* 检查是否在中断中运行                                   */
+    {
+        *p_err = OS_ERR_POST_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                 /* Is the kernel running?                                 */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return;
+    }
+#endif
+
+#if OS_CFG_ARG_CHK_EN > 0u
+    if(p_cond == RT_NULL)                                   /* 检查指针是否为空                                       */
+    {
+        *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+#endif
+
+#if OS_CFG_OBJ_TYPE_CHK_EN > 0u
+    if(p_cond->Type != OS_OBJ_TYPE_COND)                    /* 判断内核对象是否为条件变量                             */
+    {
+        *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    readied = DEF_FALSE;
+    CPU_CRITICAL_ENTER();
+    while(!rt_list_isempty(&p_cond->WaitList))
+    {
+        thread = rt_list_entry(p_cond->WaitList.next, struct rt_thread, tlist);
+        if(OS_CondWake(p_cond, thread) == DEF_TRUE)
+        {
+            readied = DEF_TRUE;
+        }
+    }
+#if OS_CFG_DBG_EN > 0u && !defined PKG_USING_UCOSIII_WRAPPER_TINY
+    OS_CondDbgNameUpd(p_cond);
+#endif
+    CPU_CRITICAL_EXIT();
+
+    if(readied == DEF_TRUE)
+    {
+        rt_schedule();
+    }
+    *p_err = OS_ERR_NONE;
+}
+
+/*
+************************************************************************************************************************
+*                                             CREATE A CONDITION VARIABLE
+*
+* Description: This function creates a condition variable.
+*
+* Arguments  : p_cond        is a pointer to the condition variable to initialize.  Your application is responsible for
+*                            allocating storage for the condition variable.
+*
+*              p_name        is a pointer to the name you would like to give the condition variable.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE                    if the call was successful
+*                                OS_ERR_CREATE_ISR              if you called this function from an ISR
+*                                OS_ERR_ILLEGAL_CREATE_RUN_TIME if you are trying to create the condition variable
+*                                                                 after you called OSSafetyCriticalStart().
+*                                OS_ERR_NAME                    if 'p_name' is a NULL pointer
+*                                OS_ERR_OBJ_CREATED             if the condition variable has already been created
+*                                OS_ERR_OBJ_PTR_NULL            if 'p_cond' is a NULL pointer
+*
+* Returns    : none
+*
+* Note(s)    : 1) 该函数为兼容层新增函数,原版uCOS-III没有条件变量
+************************************************************************************************************************
+*/
+
+void  OSCondCreate (OS_COND   *p_cond,
+                    CPU_CHAR  *p_name,
+                    OS_ERR    *p_err)
+{
+    CPU_SR_ALLOC();
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == DEF_TRUE) {
+       *p_err = OS_ERR_ILLEGAL_CREATE_RUN_TIME;
+        return;
+    }
+#endif
+
+#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u
+    if(OSIntNestingCtr > (OS_NESTING_CTR)0)                 /* 检查是否在中断中运行                                   */
+    {
+        *p_err = OS_ERR_CREATE_ISR;
+        return;
+    }
+#endif
+
+#if OS_CFG_ARG_CHK_EN > 0u
+    if(p_cond == RT_NULL)                                   /* 检查条件变量指针是否为NULL                             */
+    {
+        *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    if(p_name == RT_NULL)                                   /* 检查条件变量名称指针是否为NULL                         */
+    {
+        *p_err = OS_ERR_NAME;
+        return;
+    }
+#endif
+
+#if OS_CFG_OBJ_TYPE_CHK_EN > 0u
+    if(p_cond->Type == OS_OBJ_TYPE_COND)                    /* 判断是否已经创建过                                     */
+    {
+        *p_err = OS_ERR_OBJ_CREATED;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    rt_list_init(&p_cond->WaitList);
+    p_cond->Type     =  OS_OBJ_TYPE_COND;
+    p_cond->MutexPtr = (OS_MUTEX *)0;
+#ifndef PKG_USING_UCOSIII_WRAPPER_TINY
+#if OS_CFG_DBG_EN > 0u
+    p_cond->NamePtr  =  p_name;
+    OS_CondDbgListAdd(p_cond);
+#endif
+    OSCondQty++;
+#endif
+    CPU_CRITICAL_EXIT();
+
+#if OS_CFG_DBG_EN == 0u || defined PKG_USING_UCOSIII_WRAPPER_TINY
+    (void)p_name;
+#endif
+   *p_err = OS_ERR_NONE;
+}
+
+/*
+************************************************************************************************************************
+*                                             DELETE A CONDITION VARIABLE
+*
+* Description: This function deletes a condition variable and readies all tasks waiting on it.
+*
+* Arguments  : p_cond        is a pointer to the condition variable to delete
+*
+*              opt           determines delete options as follows:
+*
+*                                OS_OPT_DEL_NO_PEND          Delete the condition variable ONLY if no task pending
+*                                OS_OPT_DEL_ALWAYS           Deletes the condition variable even if tasks are waiting.
+*                                                            In this case, all the tasks pending will be readied.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE                 The call was successful and the object was deleted
+*                                OS_ERR_DEL_ISR              If you attempted to delete the object from an ISR
+*                                OS_ERR_ILLEGAL_DEL_RUN_TIME If you are trying to delete the object after you called
+*                                                               OSSafetyCriticalStart()
+*                                OS_ERR_OBJ_PTR_NULL         If 'p_cond' is a NULL pointer.
+*                                OS_ERR_OBJ_TYPE             If 'p_cond' is not pointing to a condition variable
+*                                OS_ERR_OPT_INVALID          An invalid option was specified
+*                                OS_ERR_OS_NOT_RUNNING       If uC/OS-III is not running yet
+*                                OS_ERR_TASK_WAITING         One or more tasks were waiting on the condition variable
+*
+* Returns    : == 0          if no tasks were waiting on the condition variable, or upon error.
+*              >  0          if one or more tasks waiting on the condition variable are now readied and informed.
+*
+* Note(s)    : 1) 被唤醒的任务重新获得互斥量后从OSCondWait()返回OS_ERR_RT_ERROR.
+************************************************************************************************************************
+*/
+
+#if OS_CFG_COND_DEL_EN > 0u
+OS_OBJ_QTY  OSCondDel (OS_COND  *p_cond,
+                       OS_OPT    opt,
+                       OS_ERR   *p_err)
+{
+    OS_OBJ_QTY   nbr_tasks;
+    rt_thread_t  thread;
+
+    CPU_SR_ALLOC();
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return ((OS_OBJ_QTY)0);
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == OS_TRUE) {
+       *p_err = OS_ERR_ILLEGAL_DEL_RUN_TIME;
+        return (0u);
+    }
+#endif
+
+#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u
+    if(OSIntNestingCtr > (OS_NESTING_CTR)0)                 /* 检查是否在中断中运行                                   */
+    {
+        *p_err = OS_ERR_DEL_ISR;
+        return 0;
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                 /* Is the kernel running?                                 */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return (0u);
+    }
+#endif
+
+#if OS_CFG_ARG_CHK_EN > 0u
+    if(p_cond == RT_NULL)                                   /* 检查指针是否为空                                       */
+    {
+        *p_err = OS_ERR_OBJ_PTR_NULL;
+        return 0;
+    }
+    switch (opt) {
+        case OS_OPT_DEL_NO_PEND:
+        case OS_OPT_DEL_ALWAYS:
+             break;
+
+        default:
+            *p_err =  OS_ERR_OPT_INVALID;
+             return ((OS_OBJ_QTY)0);
+    }
+#endif
+
+#if OS_CFG_OBJ_TYPE_CHK_EN > 0u
+    if(p_cond->Type != OS_OBJ_TYPE_COND)                    /* 判断内核对象是否为条件变量                             */
+    {
+        *p_err = OS_ERR_OBJ_TYPE;
+        return 0;
+    }
+#endif
+
+    nbr_tasks = (OS_OBJ_QTY)0;
+    CPU_CRITICAL_ENTER();
+    if((opt == OS_OPT_DEL_NO_PEND) && (!rt_list_isempty(&p_cond->WaitList)))
+    {
+        CPU_CRITICAL_EXIT();
+        *p_err = OS_ERR_TASK_WAITING;
+        return 0;
+    }
+
+    while(!rt_list_isempty(&p_cond->WaitList))              /* 唤醒所有等待者                                         */
+    {
+        thread = rt_list_entry(p_cond->WaitList.next, struct rt_thread, tlist);
+        thread->error = -RT_ERROR;
+        rt_thread_resume(thread);
+        nbr_tasks++;
+    }
+
+#ifndef PKG_USING_UCOSIII_WRAPPER_TINY
+#if OS_CFG_DBG_EN > 0u
+    OS_CondDbgListRemove(p_cond);
+#endif
+    OSCondQty--;
+#endif
+    OS_CondClr(p_cond);
+    CPU_CRITICAL_EXIT();
+
+    if(nbr_tasks > (OS_OBJ_QTY)0)
+    {
+        rt_schedule();
+    }
+
+    *p_err = OS_ERR_NONE;
+    return nbr_tasks;
+}
+#endif
+
+/*
+************************************************************************************************************************
+*                                            SIGNAL A CONDITION VARIABLE
+*
+* Description: This function signals the highest priority task waiting on a condition variable.
+*
+* Arguments  : p_cond    is a pointer to the condition variable
+*
+*              p_err     is a pointer to a variable that will contain an error code returned by this function.
+*
+*                            OS_ERR_NONE             The call was successful
+*                            OS_ERR_OBJ_PTR_NULL     If 'p_cond' is a NULL pointer.
+*                            OS_ERR_OBJ_TYPE         If 'p_cond' is not pointing at a condition variable
+*                            OS_ERR_OS_NOT_RUNNING   If uC/OS-III is not running yet
+*                            OS_ERR_POST_ISR         If you attempted to call this function from an ISR
+*
+* Returns    : none
+*
+* Note(s)    : 1) 没有任务等待时该函数不做任何事情,通知不会被保存.
+************************************************************************************************************************
+*/
+
+void  OSCondSignal (OS_COND  *p_cond,
+                    OS_ERR   *p_err)
+{
+    struct rt_thread  *thread;
+    CPU_BOOLEAN        readied;
+
+    CPU_SR_ALLOC();
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u
+    if(OSIntNestingCtr > (OS_NESTING_CTR)0)                 /* 检查是否在中断中运行                                   */
+    {
+        *p_err = OS_ERR_POST_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                 /* Is the kernel running?                                 */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return;
+    }
+#endif
+
+#if OS_CFG_ARG_CHK_EN > 0u
+    if(p_cond == RT_NULL)                                   /* 检查指针是否为空                                       */
+    {
+        *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+#endif
+
+#if OS_CFG_OBJ_TYPE_CHK_EN > 0u
+    if(p_cond->Type != OS_OBJ_TYPE_COND)                    /* 判断内核对象是否为条件变量                             */
+    {
+        *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    readied = DEF_FALSE;
+    CPU_CRITICAL_ENTER();
+    if(!rt_list_isempty(&p_cond->WaitList))
+    {
+        thread = rt_list_entry(p_cond->WaitList.next, struct rt_thread, tlist);
+        readied = OS_CondWake(p_cond, thread);
+#if OS_CFG_DBG_EN > 0u && !defined PKG_USING_UCOSIII_WRAPPER_TINY
+        OS_CondDbgNameUpd(p_cond);
+#endif
+    }
+    CPU_CRITICAL_EXIT();
+
+    if(readied == DEF_TRUE)
+    {
+        rt_schedule();
+    }
+    *p_err = OS_ERR_NONE;
+}
+
+/*
+************************************************************************************************************************
+*                                            WAIT ON A CONDITION VARIABLE
+*
+* Description: This function atomically releases a mutex and waits for a condition variable to be signaled.  The mutex
+*              is obtained again before the function returns, whatever the result of the wait.
+*
+* Arguments  : p_cond        is a pointer to the condition variable
+*
+*              p_mutex       is a pointer to the mutex protecting the condition.  The calling task must own it exactly
+*                            once (i.e. not nested).
+*
+*              timeout       is an optional timeout period (in clock ticks).  If non-zero, your task will wait for the
+*                            signal up to the amount of time (in 'ticks') specified by this argument.  If you specify
+*                            0, however, your task will wait forever.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE               The condition variable was signaled
+*                                OS_ERR_MUTEX_NESTING      If the calling task owns 'p_mutex' more than once
+*                                OS_ERR_MUTEX_NOT_OWNER    If the calling task does not own 'p_mutex'
+*                                OS_ERR_OBJ_PTR_NULL       If 'p_cond' or 'p_mutex' is a NULL pointer.
+*                                OS_ERR_OBJ_TYPE           If 'p_cond' or 'p_mutex' is not pointing at the right type
+*                                OS_ERR_OS_NOT_RUNNING     If uC/OS-III is not running yet
+*                                OS_ERR_PEND_ABORT         If the wait was aborted by another task
+*                                OS_ERR_PEND_ISR           If you called this function from an ISR
+*                                OS_ERR_SCHED_LOCKED       If you called this function when the scheduler is locked
+*                                OS_ERR_TIMEOUT            The condition variable was not signaled within the timeout
+*                              + OS_ERR_COND_MUTEX         If other tasks are waiting on 'p_cond' with another mutex
+*                              + OS_ERR_RT_ERROR           If the condition variable was deleted
+*
+* Returns    : none
+*
+* Note(s)    : 1) 与其他实现一样,该函数可能在条件并不成立时返回,调用者应该在循环中检查条件.
+*
+*              2) 只有在'p_err'为OS_ERR_MUTEX_NESTING/OS_ERR_MUTEX_NOT_OWNER等参数错误时,返回时互斥量的状态不变;
+*                 其他情况下返回时调用者都持有互斥量.
+************************************************************************************************************************
+*/
+
+void  OSCondWait (OS_COND   *p_cond,
+                  OS_MUTEX  *p_mutex,
+                  OS_TICK    timeout,
+                  OS_ERR    *p_err)
+{
+    OS_TCB       *p_tcb;
+    OS_ERR        err;
+    rt_tick_t     time;
+    CPU_BOOLEAN   owned;
+
+    CPU_SR_ALLOC();
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u
+    if(OSIntNestingCtr > (OS_NESTING_CTR)0)                 /* 检查是否在中断中运行                                   */
+    {
+        *p_err = OS_ERR_PEND_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                 /* Is the kernel running?                                 */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return;
+    }
+#endif
+
+#if OS_CFG_ARG_CHK_EN > 0u
+    if((p_cond == RT_NULL) || (p_mutex == RT_NULL))         /* 检查指针是否为空                                       */
+    {
+        *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+#endif
+
+#if OS_CFG_OBJ_TYPE_CHK_EN > 0u
+    if((p_cond->Type != OS_OBJ_TYPE_COND) ||
+       (rt_object_get_type(&p_mutex->Mutex.parent.parent) != RT_Object_Class_Mutex))
+    {
+        *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    if(OSSchedLockNestingCtr > (OS_NESTING_CTR)0)           /* 检查调度器是否被锁                                     */
+    {
+        *p_err = OS_ERR_SCHED_LOCKED;
+        return;
+    }
+
+    p_tcb = OSTCBCurPtr;
+
+    rt_enter_critical();                                    /* 从释放互斥量到进入等待链表,不允许任务切换              */
+    CPU_CRITICAL_ENTER();
+    if(p_mutex->Mutex.owner != &p_tcb->Task)
+    {
+        *p_err = OS_ERR_MUTEX_NOT_OWNER;
+    }
+    else if(p_mutex->Mutex.hold > (OS_NESTING_CTR)1)        /* 嵌套持有时释放一次不能让出互斥量                       */
+    {
+        *p_err = OS_ERR_MUTEX_NESTING;
+    }
+    else if((!rt_list_isempty(&p_cond->WaitList)) && (p_cond->MutexPtr != p_mutex))
+    {
+        *p_err = OS_ERR_COND_MUTEX;
+    }
+    else
+    {
+        *p_err = OS_ERR_NONE;
+        p_cond->MutexPtr = p_mutex;
+    }
+    CPU_CRITICAL_EXIT();
+    if(*p_err != OS_ERR_NONE)
+    {
+        rt_exit_critical();
+        return;
+    }
+
+    OSMutexPost(p_mutex, OS_OPT_POST_NONE, &err);           /* 调度器被锁,互斥量交给其他任务后也不会立即切换          */
+
+    CPU_CRITICAL_ENTER();
+    p_tcb->PendStatus  = OS_STATUS_PEND_OK;                 /* Clear pend status                                      */
+    p_tcb->TaskState  |= OS_TASK_STATE_PEND;
+    p_tcb->PendOn      = OS_TASK_PEND_ON_COND;
+    p_tcb->Task.error  = RT_EOK;
+#if OS_CFG_DBG_EN > 0u && !defined PKG_USING_UCOSIII_WRAPPER_TINY
+    p_tcb->DbgNamePtr  = p_cond->NamePtr;
+#endif
+    rt_thread_suspend(&p_tcb->Task);                        /* 挂起当前线程,按优先级插入等待链表                      */
+    rt_ipc_list_insert_prio(&p_cond->WaitList, &p_tcb->Task);
+    if(timeout > (OS_TICK)0)                                /* 在uCOS-III中timeout=0表示永久阻塞                      */
+    {
+        time = timeout;
+        rt_timer_control(&p_tcb->Task.thread_timer, RT_TIMER_CTRL_SET_TIME, &time);
+        rt_timer_start(&p_tcb->Task.thread_timer);
+    }
+#if OS_CFG_DBG_EN > 0u && !defined PKG_USING_UCOSIII_WRAPPER_TINY
+    OS_CondDbgNameUpd(p_cond);
+#endif
+    CPU_CRITICAL_EXIT();
+
+    rt_exit_critical();                                     /* 解锁调度器,在这里让出CPU                               */
+
+    CPU_CRITICAL_ENTER();
+    p_tcb->TaskState &= ~OS_TASK_STATE_PEND;                /* 更新任务状态                                           */
+    p_tcb->PendOn     = OS_TASK_PEND_ON_NOTHING;            /* 清除当前任务等待状态                                   */
+#if OS_CFG_DBG_EN > 0u && !defined PKG_USING_UCOSIII_WRAPPER_TINY
+    p_tcb->DbgNamePtr = (CPU_CHAR *)((void *)" ");
+    OS_CondDbgNameUpd(p_cond);
+#endif
+    if(p_tcb->PendStatus == OS_STATUS_PEND_ABORT)           /* 在互斥量的等待链表上被OSMutexPendAbort()放弃           */
+    {
+        *p_err = OS_ERR_PEND_ABORT;
+    }
+    else
+    {
+        *p_err = rt_err_to_ucosiii(p_tcb->Task.error);
+    }
+    owned = (p_mutex->Mutex.owner == &p_tcb->Task) ? DEF_TRUE : DEF_FALSE;
+#if OS_CFG_MUTEX_PROFILE_EN > 0u
+    if((owned == DEF_TRUE) && (p_mutex->HeldTCBPtr == (OS_TCB *)0))
+    {
+        OS_MutexHeldAdd(p_mutex, p_tcb);                    /* 由rt_mutex_release()直接交给本任务,开始计时            */
+    }
+#endif
+    CPU_CRITICAL_EXIT();
+
+    if(owned == DEF_FALSE)                                  /* 无论等待的结果如何,返回前都要重新获得互斥量            */
+    {
+        OSMutexPend(p_mutex, 0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+        if(*p_err == OS_ERR_NONE)
+        {
+            *p_err = err;
+        }
+    }
+}
+
+/*
+************************************************************************************************************************
+*                                        WAKE A TASK WAITING ON A CONDITION VARIABLE
+*
+* Description: This function removes a task from the wait list of a condition variable.  If the mutex used with the
+*              condition variable is owned by another task, the task is moved onto the wait list of the mutex and stays
+*              suspended, otherwise it is readied and will call OSMutexPend() itself.
+*
+* Arguments  : p_cond      is a pointer to the condition variable
+*
+*              thread      is the thread to wake, it must be on the wait list of 'p_cond'
+*
+* Returns    : DEF_TRUE    if the task was readied (the caller should call the scheduler)
+*              DEF_FALSE   if the task was moved onto the wait list of the mutex
+*
+* Note(s)    : 1) 必须在关中断(临界区)内调用.
+*
+*              2) 移到互斥量等待链表上的方法与rt_mutex_take()相同:按优先级插入,若等待者的优先级高于持有者,则提升
+*                 持有者的优先级.互斥量被释放时,rt_mutex_release()将互斥量交给等待链表上的第一个任务并将其唤醒.
+************************************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  OS_CondWake (OS_COND           *p_cond,
+                                  struct rt_thread  *thread)
+{
+    struct rt_mutex  *p_mutex;
+
+
+    p_mutex = &p_cond->MutexPtr->Mutex;
+    if ((p_mutex->owner == RT_NULL) ||                      /* 互斥量空闲,直接唤醒                                    */
+#if OS_CFG_MUTEX_CEILING_EN > 0u
+        (p_cond->MutexPtr->CeilingPrio != (OS_PRIO)OS_PRIO_INIT) ||
+#endif
+        (p_mutex->owner == thread)) {
+        rt_thread_resume(thread);                           /* 从等待链表中移除并就绪                                 */
+        return (DEF_TRUE);
+    }
+
+    rt_timer_stop(&thread->thread_timer);                   /* 已经收到通知,不再超时                                  */
+    rt_list_remove(&thread->tlist);
+    rt_ipc_list_insert_prio(&p_mutex->parent.suspend_thread, thread);
+    ((OS_TCB *)thread)->PendOn = OS_TASK_PEND_ON_MUTEX;
+    if (thread->current_priority < p_mutex->owner->current_priority) {
+        rt_thread_control(p_mutex->owner, RT_THREAD_CTRL_CHANGE_PRIORITY, &thread->current_priority);
+    }
+    return (DEF_FALSE);
+}
+
+/*
+************************************************************************************************************************
+*                                     UPDATE THE NAME OF THE FIRST TASK WAITING ON THE CONDITION VARIABLE
+*
+* Description: This function sets .DbgNamePtr to the name of the highest priority task waiting on the condition
+*              variable.
+*
+* Arguments  : p_cond      is a pointer to the condition variable
+*
+* Returns    : none
+*
+* Note(s)    : 1) 必须在关中断(临界区)内调用.
+************************************************************************************************************************
+*/
+
+#if OS_CFG_DBG_EN > 0u && !defined PKG_USING_UCOSIII_WRAPPER_TINY
+static  void  OS_CondDbgNameUpd (OS_COND  *p_cond)
+{
+    struct rt_thread  *thread;
+
+
+    if (!rt_list_isempty(&p_cond->WaitList)) {
+        thread = rt_list_entry(p_cond->WaitList.next, struct rt_thread, tlist);
+        p_cond->DbgNamePtr = thread->name;
+    } else {
+        p_cond->DbgNamePtr = (CPU_CHAR *)((void *)" ");     /* 若为空,则清空当前.DbgNamePtr                           */
+    }
+}
+#endif
+
+/*
+************************************************************************************************************************
+*                                       CLEAR THE CONTENTS OF A CONDITION VARIABLE
+*
+* Description: This function is called by OSCondDel() to clear the contents of a condition variable
+*
+
+* Argument(s): p_cond       is a pointer to the condition variable to clear
+*              ------
+*
+* Returns    : none
+*
+* Note(s)    : This function is INTERNAL to uC/OS-III and your application should not call it.
+************************************************************************************************************************
+*/
+
+void  OS_CondClr (OS_COND  *p_cond)
+{
+    p_cond->Type     =  OS_OBJ_TYPE_NONE;                   /* Mark the data structure as a NONE                      */
+    p_cond->MutexPtr = (OS_MUTEX *)0;
+#ifndef PKG_USING_UCOSIII_WRAPPER_TINY
+#if (OS_CFG_DBG_EN > 0u)
+    p_cond->NamePtr  = (CPU_CHAR *)((void *)"?COND");
+#endif
+#endif
+}
+
+/*
+************************************************************************************************************************
+*                                    ADD/REMOVE CONDITION VARIABLE TO/FROM DEBUG LIST
+*
+* Description: These functions are called by uC/OS-III to add or remove a condition variable to/from the debug list.
+*
+* Arguments  : p_cond      is a pointer to the condition variable to add/remove
+*
+* Returns    : none
+*
+* Note(s)    : These functions are INTERNAL to uC/OS-III and your application should not call it.
+************************************************************************************************************************
+*/
+
+#if OS_CFG_DBG_EN > 0u && !defined PKG_USING_UCOSIII_WRAPPER_TINY
+void  OS_CondDbgListAdd (OS_COND  *p_cond)
+{
+    p_cond->DbgNamePtr               = (CPU_CHAR *)((void *)" ");
+    p_cond->DbgPrevPtr               = (OS_COND  *)0;
+    if (OSCondDbgListPtr == (OS_COND *)0) {
+        p_cond->DbgNextPtr           = (OS_COND  *)0;
+    } else {
+        p_cond->DbgNextPtr           =  OSCondDbgListPtr;
+        OSCondDbgListPtr->DbgPrevPtr =  p_cond;
+    }
+    OSCondDbgListPtr                 =  p_cond;
+}
+
+
+
+void  OS_CondDbgListRemove (OS_COND  *p_cond)
+{
+    OS_COND  *p_cond_next;
+    OS_COND  *p_cond_prev;
+
+    p_cond->DbgNamePtr               = (CPU_CHAR *)((void *)" ");
+    p_cond_prev = p_cond->DbgPrevPtr;
+    p_cond_next = p_cond->DbgNextPtr;
+
+    if (p_cond_prev == (OS_COND *)0) {
+        OSCondDbgListPtr = p_cond_next;
+        if (p_cond_next != (OS_COND *)0) {
+            p_cond_next->DbgPrevPtr = (OS_COND *)0;
+        }
+        p_cond->DbgNextPtr = (OS_COND *)0;
+
+    } else if (p_cond_next == (OS_COND *)0) {
+        p_cond_prev->DbgNextPtr = (OS_COND *)0;
+        p_cond->DbgPrevPtr      = (OS_COND *)0;
+
+    } else {
+        p_cond_prev->DbgNextPtr =  p_cond_next;
+        p_cond_next->DbgPrevPtr =  p_cond_prev;
+        p_cond->DbgNextPtr      = (OS_COND *)0;
+        p_cond->DbgPrevPtr      = (OS_COND *)0;
+    }
+}
+#endif
+
+/*
+************************************************************************************************************************
+*                                           CONDITION VARIABLE INITIALIZATION
+*
+* Description: This function is called by OSInit() to initialize the condition variable management.
+*
+
+* Argument(s): p_err        is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE     the call was successful
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+void  OS_CondInit (OS_ERR  *p_err)
+{
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#ifndef PKG_USING_UCOSIII_WRAPPER_TINY
+#if OS_CFG_DBG_EN > 0u
+    OSCondDbgListPtr = (OS_COND *)0;
+#endif
+    OSCondQty        = (OS_OBJ_QTY)0;
+#endif
+   *p_err            =  OS_ERR_NONE;
+}
+
+#endif
@@ -68,6 +68,10 @@
 *                                OS_ERR_NONE    Initialization was successful
 *                                Other          Other OS_ERR_xxx depending on the sub-functions called by OSInit().
 * Returns    : none
+*
+* Note(s)    : 1) OSInit()及其创建的对象、任务会读取时间戳(OS_TS_GET()),因此OSInit()首先启动时间戳定时器,应用程序
+*                 仍可在OSInit()/OSStart()之后调用CPU_Init(),时间戳计数不会被复位.使用Cortex-M的DWT周期计数器时,
+*                 还需在CPU_Init()之后调用CPU_TS_TmrFreqSet()设置其频率(即CPU主频).
 ************************************************************************************************************************
 */
 
@@ -84,16 +88,32 @@ void  OSInit (OS_ERR  *p_err)
     }
 #endif
 
+#if (CPU_CFG_TS_TMR_EN == DEF_ENABLED)
+    CPU_TS_TmrInit();                                       /* Start the timestamp timer first (see Note #1)          */
+#endif
+
     CPU_CRITICAL_ENTER();
 
     OSInitHook();                                           /* Call port specific initialization code                 */
 
+#if OS_CFG_TRACE_EN > 0u
+    OS_TraceInit();                                         /* Initialize the trace recorder                          */
+#endif
+
     OSRunning = OS_STATE_OS_STOPPED;                        /* Indicate that multitasking not started                 */
 
 #if OS_CFG_TASK_REG_TBL_SIZE > 0u
     OSTaskRegNextAvailID = (OS_REG_ID)0;
 #endif
 
+#if defined(OS_CFG_TLS_TBL_SIZE) && (OS_CFG_TLS_TBL_SIZE > 0u)
+    OS_TLS_Init(p_err);                                     /* Initialize Task Local Storage, before creating tasks   */
+    if (*p_err != OS_ERR_NONE) {
+        CPU_CRITICAL_EXIT();
+        return;
+    }
+#endif
+
 #ifdef OS_SAFETY_CRITICAL_IEC61508
     OSSafetyCriticalStartFlag = DEF_FALSE;
 #endif
@@ -103,6 +123,14 @@ void  OSInit (OS_ERR  *p_err)
     OSSchedRoundRobinDfltTimeQuanta = OS_CFG_TICK_RATE_HZ / 10u;
 #endif
 
+#if OS_CFG_SCHED_LOCK_TIME_MEAS_EN > 0u
+    OSSchedLockTimeBegin            = (CPU_TS)0;
+    OSSchedLockTimeMax              = (CPU_TS)0;
+    OSSchedLockTimeMaxCur           = (CPU_TS)0;
+    OSSchedLockOwnerName            = (const CPU_CHAR *)0;
+    OSSchedLockTimeMaxName[0]       = '\0';
+#endif
+
 #if OS_CFG_SEM_EN > 0u                                      /* Initialize the Semaphore Manager module                */
     OS_SemInit(p_err);
     if (*p_err != OS_ERR_NONE) {
@@ -119,6 +147,22 @@ void  OSInit (OS_ERR  *p_err)
     }
 #endif
 
+#if OS_CFG_COND_EN > 0u                                     /* Initialize the Condition Variable Manager module       */
+    OS_CondInit(p_err);
+    if (*p_err != OS_ERR_NONE) {
+        CPU_CRITICAL_EXIT();
+        return;
+    }
+#endif
+
+#if OS_CFG_RWLOCK_EN > 0u                                   /* Initialize the Reader-Writer Lock Manager module       */
+    OS_RWLockInit(p_err);
+    if (*p_err != OS_ERR_NONE) {
+        CPU_CRITICAL_EXIT();
+        return;
+    }
+#endif
+
 #if OS_CFG_FLAG_EN > 0u                                     /* Initialize the Event Flag module                       */
     OS_FlagInit(p_err);
     if (*p_err != OS_ERR_NONE) {
@@ -141,6 +185,18 @@ void  OSInit (OS_ERR  *p_err)
         return;
     }
 
+#if OS_TASK_SW_HOOK_EN > 0u
+    rt_scheduler_sethook(OSTaskSwHook);                     /* 向RTT注册任务切换钩子函数,用于任务运行时间统计         */
+#endif
+
+#if OS_CFG_ISR_POST_DEFERRED_EN > 0u
+    OS_IntQTaskInit(p_err);                                 /* Initialize the ISR queue handler task                  */
+    if (*p_err != OS_ERR_NONE) {
+        CPU_CRITICAL_EXIT();
+        return;
+    }
+#endif
+
 #if OS_CFG_STAT_TASK_EN > 0u
     OS_IdleTaskInit(p_err);                                 /* Initialize the Idle Task                               */
     if (*p_err != OS_ERR_NONE) {
@@ -225,6 +281,7 @@ void  OSIntEnter (void)
     }
 
     rt_interrupt_enter();
+    OS_TRACE(OS_TRACE_EV_ISR_ENTER, 0, 0u);
 }
 
 /*
@@ -253,6 +310,7 @@ void  OSIntExit (void)
         return;                                                 /* No                                                 */
     }
 
+    OS_TRACE(OS_TRACE_EV_ISR_EXIT, 0, 0u);
     rt_interrupt_leave();
 }
 
@@ -332,6 +390,8 @@ void  OSSched (void)
 *
 * Note(s)    : 1) You MUST invoke OSSchedLock() and OSSchedUnlock() in pair.  In other words, for every
 *                 call to OSSchedLock() you MUST have a call to OSSchedUnlock().
+*
+*              2) OS_CFG_SCHED_LOCK_TIME_MEAS_EN使能时,从最外层OSSchedLock()开始测量调度器锁定的时间.
 ************************************************************************************************************************
 */
 
@@ -364,6 +424,11 @@ void  OSSchedLock (OS_ERR  *p_err)
 
     *p_err = OS_ERR_NONE;                                       /* rt_enter_critical没有返回错误码                    */
     rt_enter_critical();
+#if OS_CFG_SCHED_LOCK_TIME_MEAS_EN > 0u
+    if (OSSchedLockNestingCtr == (OS_NESTING_CTR)1u) {          /* 最外层锁定,开始测量 (see Note #2)                  */
+        OS_SchedLockTimeMeasStart();
+    }
+#endif
 }
 
 /*
@@ -384,6 +449,8 @@ void  OSSchedLock (OS_ERR  *p_err)
 *
 * Note(s)    : 1) You MUST invoke OSSchedLock() and OSSchedUnlock() in pair.  In other words, for every call to
 *                 OSSchedLock() you MUST have a call to OSSchedUnlock().
+*
+*              2) OS_CFG_SCHED_LOCK_TIME_MEAS_EN使能时,在最外层OSSchedUnlock()解锁之前结束测量.
 ************************************************************************************************************************
 */
 
@@ -417,6 +484,11 @@ void  OSSchedUnlock (OS_ERR  *p_err)
 
     *p_err = OS_ERR_NONE;                                       /* rt_exit_critical没有返回错误码                     */
 
+#if OS_CFG_SCHED_LOCK_TIME_MEAS_EN > 0u
+    if (OSSchedLockNestingCtr == (OS_NESTING_CTR)1u) {          /* 即将完全解锁,结束测量 (see Note #2)                */
+        OS_SchedLockTimeMeasStop();
+    }
+#endif
     rt_exit_critical();
 
     if (OSSchedLockNestingCtr > (OS_NESTING_CTR)0)              /* 检查调度器是否还有锁定嵌套                         */
@@ -644,6 +716,207 @@ CPU_INT16U  OSVersion (OS_ERR  *p_err)
     return OS_VERSION;
 }
 
+#if OS_CFG_TS_EN > 0u
+/*
+************************************************************************************************************************
+*                                               GET THE TIMESTAMP OF A POST
+*
+* Description: This function returns the timestamp to be recorded by a post call.
+*
+* Arguments  : none
+*
+* Returns    : The timestamp of the post.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) 由中断延迟发布任务重新发布时,返回中断中调用OSxxxPost()时记录的时间戳,而不是重新发布的时间.
+************************************************************************************************************************
+*/
+
+CPU_TS  OS_PostTS (void)
+{
+#if OS_CFG_ISR_POST_DEFERRED_EN > 0u
+    if (OSTCBCurPtr == &OSIntQTaskTCB) {                        /* 中断延迟发布任务正在重新发布中断中的Post           */
+        return (OSIntQOutPtr->TS);
+    }
+#endif
+    return (OS_TS_GET());
+}
+#endif
+
+
+#if OS_CFG_SCHED_LOCK_TIME_MEAS_EN > 0u
+/*
+************************************************************************************************************************
+*                                       START/STOP SCHEDULER LOCK TIME MEASUREMENT
+*
+* Description: These functions are called by OSSchedLock()/OSSchedUnlock() at the outermost nesting level to measure
+*              how long the scheduler stays locked.
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : 1) These functions are INTERNAL to uC/OS-III and your application MUST NOT call them.
+*
+*              2) 锁定时间最长者默认记为当前任务的名称;由定时器回调引起的锁定,由OS_SchedLockOwnerSet()改记为定时器名称.
+*
+*              3) OSSchedLockTimeMaxCur和OSSchedLockTimeMax由OSStatReset()复位.
+************************************************************************************************************************
+*/
+
+void  OS_SchedLockTimeMeasStart (void)
+{
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+                                                                /* 默认归属于当前任务 (see Note #2)                   */
+    OSSchedLockOwnerName = (const CPU_CHAR *)rt_thread_self()->name;
+    OSSchedLockTimeBegin = OS_TS_GET();
+    CPU_CRITICAL_EXIT();
+}
+
+
+void  OS_SchedLockTimeMeasStop (void)
+{
+    CPU_TS  delta;
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    delta = OS_TS_GET() - OSSchedLockTimeBegin;
+    if (OSSchedLockTimeMaxCur < delta) {
+        OSSchedLockTimeMaxCur = delta;
+    }
+    if (OSSchedLockTimeMax < delta) {                           /* 记录锁定时间最长者                                 */
+        OSSchedLockTimeMax = delta;
+        if (OSSchedLockOwnerName != (const CPU_CHAR *)0) {
+            rt_strncpy(OSSchedLockTimeMaxName, OSSchedLockOwnerName, RT_NAME_MAX);
+        }
+    }
+    CPU_CRITICAL_EXIT();
+}
+
+/*
+************************************************************************************************************************
+*                                         SET THE OWNER OF THE SCHEDULER LOCK
+*
+* Description: This function is called by the timer manager after locking the scheduler, so that the lock time of a
+*              timer callback is attributed to the timer instead of the timer thread.
+*
+* Arguments  : p_name    is the name of the object holding the scheduler lock.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) 仅在最外层锁定时生效,嵌套锁定的时间仍归属于最外层的锁定者.
+************************************************************************************************************************
+*/
+
+void  OS_SchedLockOwnerSet (const CPU_CHAR  *p_name)
+{
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    if (OSSchedLockNestingCtr == (OS_NESTING_CTR)1u) {          /* See Note #2                                        */
+        OSSchedLockOwnerName = p_name;
+    }
+    CPU_CRITICAL_EXIT();
+}
+#endif
+
+#if OS_CFG_OBJ_STAT_EN > 0u
+/*
+************************************************************************************************************************
+*                                          CLEAR PER-OBJECT CONTENTION STATISTICS
+*
+* Description: This function is called by OSSemCreate(), OSMutexCreate(), OSQCreate() and OSFlagCreate() to clear the
+*              contention statistics of a kernel object.
+*
+* Arguments  : p_stat    is a pointer to the statistics of the kernel object.
+*
+* Returns    : none
+*
+* Note(s)    : This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+void  OS_ObjStatClr (OS_OBJ_STAT  *p_stat)
+{
+    p_stat->PendCtr             = (OS_CTR)0;
+    p_stat->PendBlockCtr        = (OS_CTR)0;
+    p_stat->PendTimeoutCtr      = (OS_CTR)0;
+    p_stat->PendAbortCtr        = (OS_CTR)0;
+    p_stat->PendBlockTicksTotal = (OS_TICK)0;
+    p_stat->PendBlockTicksMax   = (OS_TICK)0;
+    p_stat->PendWaiters         = (OS_OBJ_QTY)0;
+    p_stat->PendWaitersMax      = (OS_OBJ_QTY)0;
+}
+
+/*
+************************************************************************************************************************
+*                                         RECORD A BLOCKING PEND ON A KERNEL OBJECT
+*
+* Description: OS_ObjStatPendBlock() is called by the pend functions when the resource is not available and the calling
+*              task is about to block.  OS_ObjStatPendEnd() is called once the task has been made ready again.
+*
+* Arguments  : p_stat    is a pointer to the statistics of the kernel object.
+*
+*              start     is the value returned by OS_ObjStatPendBlock().
+*
+*              p_tcb     is a pointer to the TCB of the task that was blocked.
+*
+*              err       is the error code returned by the pend.
+*
+* Returns    : OS_ObjStatPendBlock() returns the tick count at which the task started to block.
+*
+* Note(s)    : 1) These functions are INTERNAL to uC/OS-III and your application MUST NOT call them.
+*
+*              2) OS_ObjStatPendBlock()必须在关中断(临界区)内调用,与判断资源是否可用在同一个临界区中完成.
+************************************************************************************************************************
+*/
+
+OS_TICK  OS_ObjStatPendBlock (OS_OBJ_STAT  *p_stat)
+{
+    p_stat->PendBlockCtr++;
+    p_stat->PendWaiters++;
+    if (p_stat->PendWaitersMax < p_stat->PendWaiters) {
+        p_stat->PendWaitersMax = p_stat->PendWaiters;
+    }
+    return ((OS_TICK)rt_tick_get());
+}
+
+
+void  OS_ObjStatPendEnd (OS_OBJ_STAT  *p_stat,
+                         OS_TICK       start,
+                         OS_TCB       *p_tcb,
+                         OS_ERR        err)
+{
+    OS_TICK  ticks;
+    CPU_SR_ALLOC();
+
+
+    ticks = (OS_TICK)rt_tick_get() - start;
+    CPU_CRITICAL_ENTER();
+    if (p_stat->PendWaiters > (OS_OBJ_QTY)0) {
+        p_stat->PendWaiters--;
+    }
+    p_stat->PendBlockTicksTotal += ticks;
+    if (p_stat->PendBlockTicksMax < ticks) {
+        p_stat->PendBlockTicksMax = ticks;
+    }
+    if (p_tcb->PendStatus == OS_STATUS_PEND_ABORT) {
+        p_stat->PendAbortCtr++;
+    } else if (err == OS_ERR_TIMEOUT) {
+        p_stat->PendTimeoutCtr++;
+    }
+    CPU_CRITICAL_EXIT();
+}
+#endif
+
 
 #if OS_CFG_STAT_TASK_EN > 0u
 /*
@@ -709,6 +982,11 @@ void  OS_IdleTaskInit (OS_ERR  *p_err)
     }
 #endif
     OSIdleTaskCtr = (OS_IDLE_CTR)0;
+#if OS_CFG_STAT_TASK_TS_EN > 0u
+    OSStatTaskIdlePtr    = rt_thread_idle_gethandler();         /* 空闲线程的运行时间由OSTaskSwHook()按时间戳累计      */
+    OSStatTaskIdleTS     = OS_TS_GET();
+    OSStatTaskIdleCycles = (OS_CYCLES)0;
+#endif
     rt_thread_idle_sethook(OS_IdleTask);                        /* 向RTT注册μCOS-III兼容层空闲任务(实则为回调函数)    */
 }
 
@@ -178,3 +178,132 @@ void  OSTaskDelHook (OS_TCB  *p_tcb)
     CPU_VAL_UNUSED(p_tcb);                                            /* Prevent compiler warning                               */
 #endif
 }
+
+#if OS_CFG_TASK_STK_CANARY_EN > 0u
+/*
+*********************************************************************************************************
+*                                        TASK STACK OVERFLOW HOOK
+*
+* Description: This function is called when the stack canary of a task is found to be overwritten.
+*
+* Arguments  : p_tcb        Pointer to the task control block of the task whose stack overflowed.
+*
+* Note(s)    : 1) 该函数在OSTaskSwHook()中被调用,即处于RT-Thread调度器内部且中断已关闭,不能调用任何可能引起阻塞
+*                 或调度的函数.通常在此记录任务名称并进入故障处理(例如复位或停机),此时该任务的堆栈之下的内存
+*                 可能已经被破坏.
+*
+*              2) 每个任务只会报告一次.
+*********************************************************************************************************
+*/
+
+void  OSTaskStkOvfHook (OS_TCB  *p_tcb)
+{
+#if OS_CFG_APP_HOOKS_EN > 0u
+    if (OS_AppTaskStkOvfHookPtr != (OS_APP_HOOK_TCB)0) {
+        (*OS_AppTaskStkOvfHookPtr)(p_tcb);
+    }
+#else
+    CPU_VAL_UNUSED(p_tcb);                                            /* Prevent compiler warning                               */
+#endif
+}
+#endif
+
+#if OS_TASK_SW_HOOK_EN > 0u
+/*
+*********************************************************************************************************
+*                                           TASK SWITCH HOOK
+*
+* Description: This function is called when a task switch is performed.  This allows you to perform other
+*              operations during a context switch.
+*
+* Arguments  : from         Pointer to the thread being switched out.
+*
+*              to           Pointer to the thread being switched in.
+*
+* Note(s)    : 1) 该函数通过rt_scheduler_sethook()注册到RT-Thread调度器,在关中断的情况下被调用.
+*
+*              2) RT-Thread的调度器钩子会被所有线程触发,只有rt_thread.flags中带有OS_TASK_FLAG_OS_TCB标记的线程(即由
+*                 OSTaskCreate()创建的任务)才是OS_TCB,才会进行统计.该标记位于rt_thread结构体内部,判断原生线程时不会
+*                 越界访问;rt_thread.user_data留给应用程序使用,兼容层不会改写.
+*
+*              3) OS_CFG_STAT_TASK_TS_EN使能时,在此累计RT-Thread空闲线程的运行时间,供统计任务计算CPU使用率.
+*
+*              4) CPU_CFG_INT_DIS_MEAS_EN使能时,将被切出任务运行期间的关中断最大时间记入OS_TCB.IntDisTimeMax,
+*                 并复位CPU_IntDisMeasMaxCur_cnts以开始统计被切入的任务.
+*
+*              5) OS_CFG_TRACE_EN使能时,向跟踪缓冲区写入一条任务切换记录(包括非兼容层创建的线程).
+*
+*              6) OS_CFG_TASK_STK_CANARY_EN使能时,检查被切出任务的栈金丝雀(每次切换仅读取OS_TASK_STK_CANARY_NBR个字),
+*                 被改写说明堆栈已经溢出到StkLimitPtr以下,立即调用OSTaskStkOvfHook().
+*********************************************************************************************************
+*/
+
+void  OSTaskSwHook (rt_thread_t  from,
+                    rt_thread_t  to)
+{
+#if (OS_CFG_TASK_PROFILE_EN > 0u) || defined(CPU_CFG_INT_DIS_MEAS_EN) || (OS_CFG_TASK_STK_CANARY_EN > 0u)
+    OS_TCB      *p_tcb;
+#endif
+#if OS_CFG_TASK_STK_CANARY_EN > 0u
+    CPU_STK     *p_canary;
+    CPU_INT08U   i;
+#endif
+#ifdef CPU_CFG_INT_DIS_MEAS_EN
+    CPU_TS_TMR   int_dis_time;
+#endif
+#if (OS_CFG_TASK_PROFILE_EN > 0u) || ((OS_CFG_STAT_TASK_EN > 0u) && (OS_CFG_STAT_TASK_TS_EN > 0u))
+    CPU_TS       ts;
+#endif
+
+
+#if OS_CFG_TASK_STK_CANARY_EN > 0u
+    if (OS_TASK_IS_OS_TCB(from)) {                                    /* See Note #6                                            */
+        p_tcb    = (OS_TCB *)from;
+        p_canary = p_tcb->StkCanaryPtr;
+        if (p_canary != (CPU_STK *)0) {
+            for (i = 0u; i < OS_TASK_STK_CANARY_NBR; i++) {
+                if (p_canary[i] != OS_TASK_STK_CANARY) {
+                    p_tcb->StkCanaryPtr = (CPU_STK *)0;               /* 每个任务只报告一次                                     */
+                    OSTaskStkOvfHook(p_tcb);
+                    break;
+                }
+            }
+        }
+    }
+#endif
+#ifdef CPU_CFG_INT_DIS_MEAS_EN
+    int_dis_time = CPU_IntDisMeasMaxCurReset();                       /* See Note #4                                            */
+    if (OS_TASK_IS_OS_TCB(from)) {
+        p_tcb = (OS_TCB *)from;
+        if (p_tcb->IntDisTimeMax < (CPU_TS)int_dis_time) {
+            p_tcb->IntDisTimeMax = (CPU_TS)int_dis_time;
+        }
+    }
+#endif
+#if (OS_CFG_TASK_PROFILE_EN > 0u) || ((OS_CFG_STAT_TASK_EN > 0u) && (OS_CFG_STAT_TASK_TS_EN > 0u))
+    ts = OS_TS_GET();
+#endif
+#if (OS_CFG_STAT_TASK_EN > 0u) && (OS_CFG_STAT_TASK_TS_EN > 0u)
+    if (from == OSStatTaskIdlePtr) {                                  /* 离开空闲线程,累计本次空闲时间                          */
+        OSStatTaskIdleCycles += (OS_CYCLES)(ts - OSStatTaskIdleTS);
+    }
+    if (to == OSStatTaskIdlePtr) {                                    /* 进入空闲线程                                           */
+        OSStatTaskIdleTS      = ts;
+    }
+#endif
+#if OS_CFG_TASK_PROFILE_EN > 0u
+    if (OS_TASK_IS_OS_TCB(from)) {                                    /* 累加被切出任务本次运行的时间                           */
+        p_tcb               = (OS_TCB *)from;
+        p_tcb->CyclesTotal += (OS_CYCLES)(ts - p_tcb->CyclesStart);
+    }
+    if (OS_TASK_IS_OS_TCB(to)) {                                      /* 记录被切入任务的起始时间                               */
+        p_tcb               = (OS_TCB *)to;
+        p_tcb->CtxSwCtr++;
+        p_tcb->CyclesStart  = ts;
+    }
+#endif
+#if OS_CFG_TRACE_EN > 0u
+    OS_TraceTaskSw(from, to);                                         /* See Note #5                                            */
+#endif
+}
+#endif
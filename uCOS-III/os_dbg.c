@@ -75,6 +75,17 @@ CPU_INT32U  const  OSDbg_EndiannessTest        = 0x12345678LU;                 /
 
 CPU_INT08U  const  OSDbg_CalledFromISRChkEn    = OS_CFG_CALLED_FROM_ISR_CHK_EN;
 
+CPU_INT08U  const  OSDbg_CondEn                = OS_CFG_COND_EN;
+#if OS_CFG_COND_EN > 0u
+OS_COND     const  OSDbg_Cond                  = { 0u };
+CPU_INT08U  const  OSDbg_CondDelEn             = OS_CFG_COND_DEL_EN;
+CPU_INT16U  const  OSDbg_CondSize              = sizeof(OS_COND);              /* Size in bytes of OS_COND            */
+#else
+CPU_INT08U  const  OSDbg_CondDelEn             = 0u;
+CPU_INT16U  const  OSDbg_CondSize              = 0u;
+#endif
+
+
 CPU_INT08U  const  OSDbg_FlagEn                = OS_CFG_FLAG_EN;
 OS_FLAG_GRP const  OSDbg_FlagGrp               = { 0u };
 #if OS_CFG_FLAG_EN > 0u
@@ -149,6 +160,19 @@ CPU_INT16U  const  OSDbg_QSize                 = 0u;
 #endif
 
 
+CPU_INT08U  const  OSDbg_RWLockEn              = OS_CFG_RWLOCK_EN;
+#if OS_CFG_RWLOCK_EN > 0u
+OS_RWLOCK   const  OSDbg_RWLock                = { 0u };
+CPU_INT08U  const  OSDbg_RWLockDelEn           = OS_CFG_RWLOCK_DEL_EN;
+CPU_INT08U  const  OSDbg_RWLockPendAbortEn     = OS_CFG_RWLOCK_PEND_ABORT_EN;
+CPU_INT16U  const  OSDbg_RWLockSize            = sizeof(OS_RWLOCK);            /* Size in bytes of OS_RWLOCK          */
+#else
+CPU_INT08U  const  OSDbg_RWLockDelEn           = 0u;
+CPU_INT08U  const  OSDbg_RWLockPendAbortEn     = 0u;
+CPU_INT16U  const  OSDbg_RWLockSize            = 0u;
+#endif
+
+
 CPU_INT08U  const  OSDbg_SchedRoundRobinEn     = OS_CFG_SCHED_ROUND_ROBIN_EN;
 
 
@@ -198,8 +222,10 @@ CPU_INT08U  const  OSDbg_TmrEn                 = OS_CFG_TMR_EN;
 #if OS_CFG_TMR_EN > 0u
 CPU_INT08U  const  OSDbg_TmrDelEn              = OS_CFG_TMR_DEL_EN;
 CPU_INT16U  const  OSDbg_TmrSize               = sizeof(OS_TMR);
+CPU_INT08U  const  OSDbg_TmrSlackEn            = OS_CFG_TMR_SLACK_EN;
 #else
 CPU_INT08U  const  OSDbg_TmrDelEn              = 0u;
+CPU_INT08U  const  OSDbg_TmrSlackEn            = 0u;
 CPU_INT16U  const  OSDbg_TmrSize               = 0u;
 CPU_INT16U  const  OSDbg_TmrSpokeSize          = 0u;
 #endif
@@ -221,16 +247,15 @@ CPU_INT32U  const  OSDbg_DataSize = sizeof(OSIntNestingCtr)
                                   + sizeof(OS_AppTaskDelHookPtr)
                                   + sizeof(OS_AppIdleTaskHookPtr)
                                   + sizeof(OS_AppStatTaskHookPtr)
+#if OS_CFG_TASK_STK_CANARY_EN > 0u
+                                  + sizeof(OS_AppTaskStkOvfHookPtr)
+#endif
 #endif
 
 #if OS_CFG_STAT_TASK_EN > 0u
                                   + sizeof(OSIdleTaskCtr)
 #endif
 
-#ifdef CPU_CFG_INT_DIS_MEAS_EN
-                                  + sizeof(OSIntDisTimeMax)
-#endif
-
 #if OS_CFG_ISR_POST_DEFERRED_EN > 0u
                                   + sizeof(OSIntQInPtr)
                                   + sizeof(OSIntQOutPtr)
@@ -248,6 +273,13 @@ CPU_INT32U  const  OSDbg_DataSize = sizeof(OSIntNestingCtr)
                                   + sizeof(OSSafetyCriticalStartFlag)
 #endif
 
+#if OS_CFG_COND_EN > 0u
+#if OS_CFG_DBG_EN > 0u
+                                  + sizeof(OSCondDbgListPtr)
+#endif
+                                  + sizeof(OSCondQty)
+#endif
+
 #if OS_CFG_FLAG_EN > 0u
 #if OS_CFG_DBG_EN > 0u
                                   + sizeof(OSFlagDbgListPtr)
@@ -279,12 +311,27 @@ CPU_INT32U  const  OSDbg_DataSize = sizeof(OSIntNestingCtr)
                                   + sizeof(OSQQty)
 #endif
 
+#if OS_CFG_RWLOCK_EN > 0u
+#if OS_CFG_DBG_EN > 0u
+                                  + sizeof(OSRWLockDbgListPtr)
+#endif
+                                  + sizeof(OSRWLockQty)
+#endif
+
                                   + sizeof(OSSchedLockNestingCtr)
 
 #if OS_CFG_SCHED_LOCK_TIME_MEAS_EN > 0u
                                   + sizeof(OSSchedLockTimeBegin)
                                   + sizeof(OSSchedLockTimeMax)
                                   + sizeof(OSSchedLockTimeMaxCur)
+                                  + sizeof(OSSchedLockOwnerName)
+                                  + sizeof(OSSchedLockTimeMaxName)
+#endif
+
+#if OS_CFG_TRACE_EN > 0u
+                                  + sizeof(OSTraceEn)
+                                  + sizeof(OSTraceIx)
+                                  + sizeof(OSTraceCtr)
 #endif
 
 #if OS_CFG_SCHED_ROUND_ROBIN_EN
@@ -313,6 +360,17 @@ CPU_INT32U  const  OSDbg_DataSize = sizeof(OSIntNestingCtr)
                                   + sizeof(OSStatTaskCtrRun)
                                   + sizeof(OSStatTaskRdy)
                                   + sizeof(OSStatTaskTCB)
+#if OS_CFG_DBG_EN > 0u
+                                  + sizeof(OSStatTaskTCBCursorPtr)
+#if OS_CFG_TMR_EN > 0u
+                                  + sizeof(OSStatTaskTmrCursorPtr)
+#endif
+#endif
+#if OS_CFG_STAT_TASK_TS_EN > 0u
+                                  + sizeof(OSStatTaskIdlePtr)
+                                  + sizeof(OSStatTaskIdleTS)
+                                  + sizeof(OSStatTaskIdleCycles)
+#endif
 #endif
 
 #if OS_CFG_TMR_EN > 0u
@@ -320,12 +378,20 @@ CPU_INT32U  const  OSDbg_DataSize = sizeof(OSIntNestingCtr)
                                   + sizeof(OSTmrDbgListPtr)
 #endif
                                   + sizeof(OSTmrQty)
+                                  + sizeof(OSTmrExpireCtr)
+                                  + sizeof(OSTmrWakeupCtr)
+                                  + sizeof(OSTmrWakeupTick)
 #endif
 
 #if OS_CFG_TASK_REG_TBL_SIZE > 0u
                                   + sizeof(OSTaskRegNextAvailID)
 #endif
 
+#if defined(OS_CFG_TLS_TBL_SIZE) && (OS_CFG_TLS_TBL_SIZE > 0u)
+                                  + sizeof(OS_TLS_NextAvailID)
+                                  + sizeof(OS_TLS_DestructPtrTbl)
+#endif
+
                                   + sizeof(OSTCBCurPtr)
                                   ;
 
@@ -365,6 +431,15 @@ void  OS_Dbg_Init (void)
 
     p_temp = (void const *)&OSDbg_CalledFromISRChkEn;
 
+#if OS_CFG_COND_EN > 0u
+    p_temp = (void const *)&OSDbg_Cond;
+#endif
+    p_temp = (void const *)&OSDbg_CondEn;
+#if (OS_CFG_COND_EN) > 0u
+    p_temp = (void const *)&OSDbg_CondDelEn;
+    p_temp = (void const *)&OSDbg_CondSize;
+#endif
+
     p_temp = (void const *)&OSDbg_FlagGrp;
     p_temp = (void const *)&OSDbg_FlagEn;
 #if OS_CFG_FLAG_EN > 0u
@@ -410,6 +485,15 @@ void  OS_Dbg_Init (void)
     p_temp = (void const *)&OSDbg_QPendAbortEn;
     p_temp = (void const *)&OSDbg_QSize;
 #endif
+#if OS_CFG_RWLOCK_EN > 0u
+    p_temp = (void const *)&OSDbg_RWLock;
+#endif
+    p_temp = (void const *)&OSDbg_RWLockEn;
+#if (OS_CFG_RWLOCK_EN) > 0u
+    p_temp = (void const *)&OSDbg_RWLockDelEn;
+    p_temp = (void const *)&OSDbg_RWLockPendAbortEn;
+    p_temp = (void const *)&OSDbg_RWLockSize;
+#endif
 
     p_temp = (void const *)&OSDbg_SchedRoundRobinEn;
 
@@ -447,6 +531,7 @@ void  OS_Dbg_Init (void)
 #if (OS_CFG_TMR_EN) > 0u
     p_temp = (void const *)&OSDbg_TmrDelEn;
     p_temp = (void const *)&OSDbg_TmrSize;
+    p_temp = (void const *)&OSDbg_TmrSlackEn;
 #endif
 
     p_temp = (void const *)&OSDbg_VersionNbr;
@@ -160,6 +160,13 @@ void  OSFlagCreate (OS_FLAG_GRP  *p_grp,
     {
         return;
     }
+#if OS_CFG_TS_EN > 0u
+    p_grp->TS = (CPU_TS)0;
+#endif
+#if OS_CFG_OBJ_STAT_EN > 0u
+    OS_ObjStatClr(&p_grp->Stat);
+#endif
+    OS_TRACE_NAME(p_grp, p_name);
 
 #ifndef PKG_USING_UCOSIII_WRAPPER_TINY
     CPU_CRITICAL_ENTER();
@@ -403,10 +410,16 @@ OS_FLAGS  OSFlagPend (OS_FLAG_GRP  *p_grp,
 #if OS_CFG_DBG_EN > 0u && !defined PKG_USING_UCOSIII_WRAPPER_TINY
     rt_thread_t     thread;
 #endif
+#if OS_CFG_OBJ_STAT_EN > 0u
+    CPU_BOOLEAN stat_blk;
+    OS_TICK stat_start = 0u;
+#endif
 
     CPU_SR_ALLOC();
 
-    CPU_VAL_UNUSED(p_ts);
+    if (p_ts != (CPU_TS *)0) {
+       *p_ts  = (CPU_TS  )0;                                    /* Initialize the returned timestamp                  */
+    }
 
 #ifdef OS_SAFETY_CRITICAL
     if (p_err == (OS_ERR *)0) {
@@ -546,15 +559,42 @@ OS_FLAGS  OSFlagPend (OS_FLAG_GRP  *p_grp,
     p_tcb->FlagsPend = flags;                                   /* Save the flags that we need to wait for            */
     p_tcb->FlagsOpt  = opt;                                     /* Save the type of wait we are doing                 */
     p_tcb->FlagsRdy  = p_tcb->Task.event_set;                   /* Save flags that were ready                         */
+#endif
+#if OS_CFG_OBJ_STAT_EN > 0u
+    p_grp->Stat.PendCtr++;
+    if((rt_option & RT_EVENT_FLAG_AND) == RT_EVENT_FLAG_AND)    /* 所需的事件标志是否已经满足                         */
+    {
+        stat_blk = (CPU_BOOLEAN)((p_grp->FlagGrp.set & flags) != flags);
+    }
+    else
+    {
+        stat_blk = (CPU_BOOLEAN)((p_grp->FlagGrp.set & flags) == 0u);
+    }
+    if((time != RT_WAITING_NO) && (stat_blk == DEF_TRUE))       /* 只在需要阻塞时更新(慢速路径)                       */
+    {
+        stat_start = OS_ObjStatPendBlock(&p_grp->Stat);
+    }
+    else
+    {
+        stat_blk = DEF_FALSE;
+    }
 #endif
     CPU_CRITICAL_EXIT();
 
+    OS_TRACE(OS_TRACE_EV_FLAG_PEND, p_grp, flags);
     rt_err = rt_event_recv(&p_grp->FlagGrp,
                            flags,
                            rt_option,
                            time,
                            &recved);
     *p_err = rt_err_to_ucosiii(rt_err);
+    OS_TRACE(OS_TRACE_EV_FLAG_PEND_EXIT, p_grp, *p_err);
+#if OS_CFG_OBJ_STAT_EN > 0u
+    if(stat_blk == DEF_TRUE)
+    {
+        OS_ObjStatPendEnd(&p_grp->Stat, stat_start, p_tcb, *p_err);
+    }
+#endif
     if(*p_err == OS_ERR_TIMEOUT && time == RT_WAITING_NO)
     {
         *p_err = OS_ERR_PEND_WOULD_BLOCK;
@@ -588,6 +628,12 @@ OS_FLAGS  OSFlagPend (OS_FLAG_GRP  *p_grp,
         *p_err = OS_ERR_PEND_ABORT;
         return 0;
     }
+#if OS_CFG_TS_EN > 0u
+    if(rt_err == RT_EOK && p_ts != (CPU_TS *)0)
+    {
+       *p_ts = p_grp->TS;                                       /* 返回事件标志组被发布时的时间戳                     */
+    }
+#endif
     CPU_CRITICAL_EXIT();
 
     return recved;
@@ -882,6 +928,23 @@ OS_FLAGS  OSFlagPost (OS_FLAG_GRP  *p_grp,
     }
 #endif
 
+    OS_TRACE(OS_TRACE_EV_FLAG_POST, p_grp, flags);
+
+#if OS_CFG_ISR_POST_DEFERRED_EN > 0u
+    if (OSIntNestingCtr > (OS_NESTING_CTR)0) {                  /* See if called from an ISR                          */
+        OS_IntQPost((OS_OBJ_TYPE)OS_OBJ_TYPE_FLAG,              /* Post to ISR queue                                  */
+                    (void      *)p_grp,
+                    (void      *)0,
+                    (OS_MSG_SIZE)0,
+                    (OS_FLAGS   )flags,
+                    (OS_PRIO    )0,
+                    (OS_OPT     )opt,
+                    (CPU_TS     )OS_TS_GET(),
+                    (OS_ERR    *)p_err);
+        return ((OS_FLAGS)0);
+    }
+#endif
+
 #ifndef PKG_USING_UCOSIII_WRAPPER_TINY
     CPU_CRITICAL_ENTER();
     p_grp->Flags      = p_grp->FlagGrp.set;                     /* Set to desired initial value                       */
@@ -890,6 +953,9 @@ OS_FLAGS  OSFlagPost (OS_FLAG_GRP  *p_grp,
     CPU_CRITICAL_EXIT();
 #endif
 
+#if OS_CFG_TS_EN > 0u
+    p_grp->TS = OS_PostTS();                                    /* 先记录时间戳,被唤醒的任务可能立即运行              */
+#endif
     rt_err = rt_event_send(&p_grp->FlagGrp,flags);
     *p_err = rt_err_to_ucosiii(rt_err);
 
@@ -0,0 +1,406 @@
+/*
+ * Copyright (c) 2021, Meco Jianting Man <jiantingman@foxmail.com>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2026-10-19     agent        implement deferred ISR posts
+ */
+/*
+*********************************************************************************************************
+*                                              uC/OS-III
+*                                        The Real-Time Kernel
+*
+*                    Copyright 2009-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+/*
+************************************************************************************************************************
+*                                                      uC/OS-III
+*                                                 The Real-Time Kernel
+*
+*                                  (c) Copyright 2009-2012; Micrium, Inc.; Weston, FL
+*                           All rights reserved.  Protected by international copyright laws.
+*
+*                                                 ISR QUEUE MANAGEMENT
+*
+* File    : OS_INT.C
+* By      : JJL
+* Version : V3.03.00
+*
+* LICENSING TERMS:
+* ---------------
+*           uC/OS-III is provided in source form for FREE short-term evaluation, for educational use or
+*           for peaceful research.  If you plan or intend to use uC/OS-III in a commercial application/
+*           product then, you need to contact Micrium to properly license uC/OS-III for its use in your
+*           application/product.   We provide ALL the source code for your convenience and to help you
+*           experience uC/OS-III.  The fact that the source is provided does NOT mean that you can use
+*           it commercially without paying a licensing fee.
+*
+*           Knowledge of the source code may NOT be used to develop a similar product.
+*
+*           Please help us continue to provide the embedded community with the finest software available.
+*           Your honesty is greatly appreciated.
+*
+*           You can contact us at www.micrium.com, or by phone at +1 (954) 217-2036.
+************************************************************************************************************************
+* Note(s)    : 1) RTT中在中断里调用rt_sem_release()/rt_mq_send()/rt_event_send()时,会在关中断的情况下遍历挂起链表并
+*                 唤醒任务(rt_event_send()会遍历全部等待任务),关中断时间与等待任务的数量有关.
+*                 使能OS_CFG_ISR_POST_DEFERRED_EN后,中断中的OSSemPost()/OSQPost()/OSQPostPrio()/OSFlagPost()/
+*                 OSTaskNotify()仅将发布请求写入OSCfg_IntQ[]环形队列(关中断时间仅为拷贝一条记录),由优先级为0的中断处理
+*                 任务在任务级批量重新发布.OSQPostCopy()的消息内容无法延迟拷贝,此时不允许在中断中调用
+************************************************************************************************************************
+*/
+
+#include "os.h"
+
+#if OS_CFG_ISR_POST_DEFERRED_EN > 0u
+/*
+************************************************************************************************************************
+*                                                   POST TO ISR QUEUE
+*
+* Description: This function places contents of posts into an intermediate queue to help defer processing of interrupts
+*              at the task level.
+*
+* Arguments  : type       is the type of kernel object the post is destined to:
+*
+*                             OS_OBJ_TYPE_SEM
+*                             OS_OBJ_TYPE_Q
+*                             OS_OBJ_TYPE_Q_PRIO      (OSQPostPrio())
+*                             OS_OBJ_TYPE_FLAG
+*                             OS_OBJ_TYPE_TASK_NOTIFY (OSTaskNotify())
+*
+*              p_obj      is a pointer to the kernel object to post to.  This can be a pointer to a semaphore,
+*              -----      a message queue, an event flag group or the OS_TCB of the task to notify.
+*
+*              p_void     is a pointer to a message that is being posted.  This is used when posting to a message
+*                         queue.
+*
+*              msg_size   is the size of the message being posted
+*
+*              flags      if the post is done to an event flag group then this corresponds to the flags being posted.
+*                         For OSTaskNotify() this is the notification value.
+*
+*              prio       is the message priority if the post was done by OSQPostPrio()
+*
+*              opt        is the post option of the deferred post
+*
+*              ts         is a timestamp as to when the post was done
+*
+*              p_err      is a pointer to a variable that will contain an error code returned by this function.
+*
+*                             OS_ERR_NONE          the post to the ISR queue was successful
+*                             OS_ERR_INT_Q_FULL    the ISR queue is full and cannot accept any further posts.  This
+*                                                  generally indicates that you are receiving interrupts faster than
+*                                                  you can process them or, that you didn't make the ISR queue large
+*                                                  enough.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) 只有一个消费者(中断处理任务),且其只在OSIntQNbrEntries减一之后才会释放记录,因此本函数在关中断期间只需
+*                 拷贝一条记录并移动写指针,不会访问任何内核对象的挂起链表
+************************************************************************************************************************
+*/
+
+void  OS_IntQPost (OS_OBJ_TYPE   type,
+                   void         *p_obj,
+                   void         *p_void,
+                   OS_MSG_SIZE   msg_size,
+                   OS_FLAGS      flags,
+                   OS_PRIO       prio,
+                   OS_OPT        opt,
+                   CPU_TS        ts,
+                   OS_ERR       *p_err)
+{
+    OS_OBJ_QTY  nbr_entries;
+
+    CPU_SR_ALLOC();
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    nbr_entries = OSIntQNbrEntries;
+    if (nbr_entries >= (OS_OBJ_QTY)OS_CFG_INT_Q_SIZE) {     /* Make sure we haven't already filled the ISR queue      */
+        OSIntQOvfCtr++;                                     /* Count the number of ISR queue overflows                */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_INT_Q_FULL;
+        return;
+    }
+    OSIntQInPtr->Type    = type;                            /* Save object type being posted                          */
+    OSIntQInPtr->ObjPtr  = p_obj;                           /* Save pointer to object being posted                    */
+    OSIntQInPtr->MsgPtr  = p_void;                          /* Save pointer to message if posting to a message queue  */
+    OSIntQInPtr->MsgSize = msg_size;                        /* Save the message size   if posting to a message queue  */
+    OSIntQInPtr->Flags   = flags;                           /* Save the flags if posting to an event flag group       */
+#if OS_CFG_Q_PRIO_EN > 0u
+    OSIntQInPtr->Prio    = prio;                            /* Save the message priority if posting with OSQPostPrio()*/
+#else
+    (void)prio;
+#endif
+    OSIntQInPtr->Opt     = opt;                             /* Save post options                                      */
+    OSIntQInPtr->TS      = ts;                              /* Save time of post                                      */
+
+    OSIntQInPtr          = OSIntQInPtr->NextPtr;            /* Point to the next interrupt handler queue entry        */
+    OSIntQNbrEntries     = nbr_entries + (OS_OBJ_QTY)1;     /* One more entry in the queue                            */
+    if (OSIntQNbrEntriesMax < OSIntQNbrEntries) {
+        OSIntQNbrEntriesMax = OSIntQNbrEntries;
+    }
+    if (nbr_entries == (OS_OBJ_QTY)0) {                     /* 队列由空变为非空时才需要唤醒中断处理任务               */
+        rt_thread_resume(&OSIntQTaskTCB.Task);              /* 中断处理任务只可能挂起在自己身上,不会遍历任何链表      */
+    }
+    CPU_CRITICAL_EXIT();
+    if (nbr_entries == (OS_OBJ_QTY)0) {
+        rt_schedule();                                      /* 在中断中只会挂起一次切换,退出中断时才真正切换          */
+    }
+
+   *p_err = OS_ERR_NONE;
+}
+
+/*
+************************************************************************************************************************
+*                                               RE-POST FROM ISR QUEUE
+*
+* Description: This function is called by the ISR handler task to perform the post that was deferred by the ISR.
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) 重新发布时中断嵌套层数为0,因此OSxxxPost()会直接完成发布而不会再次被延迟
+************************************************************************************************************************
+*/
+
+void  OS_IntQRePost (void)
+{
+    OS_ERR  err;
+
+
+    switch (OSIntQOutPtr->Type) {                           /* Re-post to task                                        */
+#if OS_CFG_FLAG_EN > 0u
+        case OS_OBJ_TYPE_FLAG:
+             (void)OSFlagPost((OS_FLAG_GRP *)OSIntQOutPtr->ObjPtr,
+                              (OS_FLAGS     )OSIntQOutPtr->Flags,
+                              (OS_OPT       )OSIntQOutPtr->Opt,
+                              (OS_ERR      *)&err);
+             break;
+#endif
+
+#if OS_CFG_Q_EN > 0u
+        case OS_OBJ_TYPE_Q:
+             OSQPost((OS_Q      *)OSIntQOutPtr->ObjPtr,
+                     (void      *)OSIntQOutPtr->MsgPtr,
+                     (OS_MSG_SIZE)OSIntQOutPtr->MsgSize,
+                     (OS_OPT     )OSIntQOutPtr->Opt,
+                     (OS_ERR    *)&err);
+             break;
+
+#if OS_CFG_Q_PRIO_EN > 0u
+        case OS_OBJ_TYPE_Q_PRIO:
+             OSQPostPrio((OS_Q      *)OSIntQOutPtr->ObjPtr,
+                         (void      *)OSIntQOutPtr->MsgPtr,
+                         (OS_MSG_SIZE)OSIntQOutPtr->MsgSize,
+                         (OS_PRIO    )OSIntQOutPtr->Prio,
+                         (OS_OPT     )OSIntQOutPtr->Opt,
+                         (OS_ERR    *)&err);
+             break;
+#endif
+#endif
+
+#if OS_CFG_SEM_EN > 0u
+        case OS_OBJ_TYPE_SEM:
+             (void)OSSemPost((OS_SEM *)OSIntQOutPtr->ObjPtr,
+                             (OS_OPT  )OSIntQOutPtr->Opt,
+                             (OS_ERR *)&err);
+             break;
+#endif
+
+#if OS_CFG_TASK_NOTIFY_EN > 0u
+        case OS_OBJ_TYPE_TASK_NOTIFY:
+             OSTaskNotify((OS_TCB       *)OSIntQOutPtr->ObjPtr,
+                          (OS_NOTIFY_VAL )OSIntQOutPtr->Flags,
+                          (OS_OPT        )OSIntQOutPtr->Opt,
+                          (OS_ERR       *)&err);
+             break;
+#endif
+
+        default:
+             break;
+    }
+    (void)err;
+}
+
+/*
+************************************************************************************************************************
+*                                              INTERRUPT QUEUE MANAGEMENT TASK
+*
+* Description: This task is created by OS_IntQTaskInit().
+*
+* Arguments  : p_arg     is a pointer to an optional argument that is passed during task creation.  For this function
+*                        the argument is not used and will be a NULL pointer.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) 每次唤醒后锁住调度器,一次性处理完队列中的全部记录;被唤醒的任务在批量处理结束后统一参与调度
+*
+*              3) OSIntQTaskTimeMax记录单次批量处理的最长时间,单位为时间戳(OS_TS_GET())计数
+************************************************************************************************************************
+*/
+
+void  OS_IntQTask (void  *p_arg)
+{
+    CPU_BOOLEAN  done;
+    CPU_TS       ts_start;
+    CPU_TS       ts_end;
+
+    CPU_SR_ALLOC();
+
+
+    p_arg = p_arg;                                          /* Not using 'p_arg', prevent compiler warning            */
+    while (DEF_ON) {
+        CPU_CRITICAL_ENTER();
+        if (OSIntQNbrEntries == (OS_OBJ_QTY)0u) {           /* 队列为空,挂起自己,等待OS_IntQPost()唤醒               */
+            rt_thread_suspend(&OSIntQTaskTCB.Task);
+            CPU_CRITICAL_EXIT();
+            rt_schedule();
+            continue;
+        }
+        CPU_CRITICAL_EXIT();
+
+        done     = DEF_FALSE;
+        ts_start = OS_TS_GET();
+        rt_enter_critical();                                /* 批量重新发布期间锁住调度器                             */
+        while (done == DEF_FALSE) {
+            OS_IntQRePost();                                /* Re-post the oldest deferred post                       */
+            CPU_CRITICAL_ENTER();
+            OSIntQOutPtr = OSIntQOutPtr->NextPtr;           /* Point to next item in the ISR queue                    */
+            OSIntQNbrEntries--;                             /* One less entry in the queue                            */
+            if (OSIntQNbrEntries == (OS_OBJ_QTY)0u) {
+                done = DEF_TRUE;
+            }
+            CPU_CRITICAL_EXIT();
+        }
+        rt_exit_critical();
+        ts_end = OS_TS_GET() - ts_start;                    /* Measure execution time of the batch                    */
+        if (OSIntQTaskTimeMax < ts_end) {
+            OSIntQTaskTimeMax = ts_end;
+        }
+    }
+}
+
+/*
+************************************************************************************************************************
+*                                                 INITIALIZE THE ISR QUEUE
+*
+* Description: This function is called by OSInit() to initialize the ISR queue.
+*
+* Arguments  : p_err    is a pointer to a variable that will contain an error code returned by this function.
+*
+*                           OS_ERR_INT_Q             If you didn't provide an ISR queue in OS_CFG_APP.C
+*                           OS_ERR_INT_Q_SIZE        If you didn't specify a large enough ISR queue.
+*                           OS_ERR_INT_Q_STK_INVALID If you specified a NULL pointer for the task of the ISR task
+*                                                    handler
+*                           OS_ERR_INT_Q_STK_SIZE_INVALID  If you didn't specify a stack size greater than the minimum
+*                                                          specified by OS_CFG_STK_SIZE_MIN
+*                           OS_ERR_???               An error code returned by OSTaskCreate().
+*
+* Returns    : none
+*
+* Note(s)    : none
+************************************************************************************************************************
+*/
+
+void  OS_IntQTaskInit (OS_ERR  *p_err)
+{
+    OS_INT_Q      *p_int_q;
+    OS_INT_Q      *p_int_q_next;
+    OS_OBJ_QTY     i;
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+    OSIntQOvfCtr = (OS_OBJ_QTY)0u;                          /* Clear the ISR queue overflow counter                   */
+
+    if (OSCfg_IntQ == (OS_INT_Q *)0) {
+       *p_err = OS_ERR_INT_Q;
+        return;
+    }
+
+    if (OS_CFG_INT_Q_SIZE < 2u) {
+       *p_err = OS_ERR_INT_Q_SIZE;
+        return;
+    }
+
+    OSIntQTaskTimeMax = (CPU_TS)0;
+
+    p_int_q           = &OSCfg_IntQ[0];                     /* Initialize the circular ISR queue                      */
+    p_int_q_next      = p_int_q;
+    p_int_q_next++;
+    for (i = 0u; i < OS_CFG_INT_Q_SIZE; i++) {
+        p_int_q->Type    =  OS_OBJ_TYPE_NONE;
+        p_int_q->ObjPtr  = (void      *)0;
+        p_int_q->MsgPtr  = (void      *)0;
+        p_int_q->MsgSize = (OS_MSG_SIZE)0u;
+        p_int_q->Flags   = (OS_FLAGS   )0u;
+        p_int_q->Opt     = (OS_OPT     )0u;
+        p_int_q->NextPtr = p_int_q_next;
+        p_int_q++;
+        p_int_q_next++;
+    }
+    p_int_q--;
+    p_int_q_next      = &OSCfg_IntQ[0];
+    p_int_q->NextPtr  = p_int_q_next;                       /* Last entry points to first entry                       */
+    OSIntQInPtr       = p_int_q_next;
+    OSIntQOutPtr      = p_int_q_next;
+    OSIntQNbrEntries  = (OS_OBJ_QTY)0u;                     /* Indicate that the queue is empty                       */
+    OSIntQNbrEntriesMax = (OS_OBJ_QTY)0u;
+
+                                                            /* -------------- CREATE THE ISR QUEUE TASK ------------- */
+    if (OSCfg_IntQTaskStk == (CPU_STK *)0) {
+       *p_err = OS_ERR_INT_Q_STK_INVALID;
+        return;
+    }
+
+    if (OS_CFG_INT_Q_TASK_STK_SIZE < OS_CFG_STK_SIZE_MIN) {
+       *p_err = OS_ERR_INT_Q_STK_SIZE_INVALID;
+        return;
+    }
+
+    OSTaskCreate((OS_TCB     *)&OSIntQTaskTCB,
+                 (CPU_CHAR   *)((void *)"ISR Queue Task"),
+                 (OS_TASK_PTR )OS_IntQTask,
+                 (void       *)0,
+                 (OS_PRIO     )0u,                          /* This task is ALWAYS at priority '0' (i.e. highest)     */
+                 (CPU_STK    *)&OSCfg_IntQTaskStk[0],
+                 (CPU_STK_SIZE)(OS_CFG_INT_Q_TASK_STK_SIZE / 10u),
+                 (CPU_STK_SIZE)OS_CFG_INT_Q_TASK_STK_SIZE,
+                 (OS_MSG_QTY  )0u,
+                 (OS_TICK     )0u,
+                 (void       *)0,
+                 (OS_OPT      )(OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR),
+                 (OS_ERR     *)p_err);
+}
+
+#endif
@@ -303,6 +303,219 @@ void  OSMemPut (OS_MEM  *p_mem,
    *p_err              = OS_ERR_NONE;                       /* Notify caller that memory block was released           */
 }
 
+/*$PAGE*/
+/*
+************************************************************************************************************************
+*                                             GET SEVERAL MEMORY BLOCKS
+*
+* Description : Get several memory blocks from a partition in a single critical section.
+*
+* Arguments   : p_mem    is a pointer to the memory partition control block
+*
+*               p_blks   is a pointer to an array that will receive the pointers to the memory blocks obtained.  The
+*                        array must be able to hold at least 'n_blks' entries.
+*
+*               n_blks   is the number of memory blocks desired
+*
+*               opt      determines what happens when fewer than 'n_blks' blocks are free:
+*
+*                            OS_OPT_MEM_ALL            get ALL 'n_blks' blocks or none at all
+*                            OS_OPT_MEM_PARTIAL        get as many blocks as are available (up to 'n_blks')
+*
+*               p_err    is a pointer to a variable containing an error message which will be set by this function to
+*                        either:
+*
+*                            OS_ERR_NONE               if at least one memory block was obtained
+*                            OS_ERR_MEM_INVALID_BLKS   if you asked for 0 blocks
+*                            OS_ERR_MEM_INVALID_P_MEM  if you passed a NULL pointer for 'p_mem'
+*                            OS_ERR_MEM_NO_FREE_BLKS   if there are not enough free memory blocks (OS_OPT_MEM_ALL) or
+*                                                      no free memory blocks at all (OS_OPT_MEM_PARTIAL)
+*                            OS_ERR_OPT_INVALID        if you specified an invalid option
+*                            OS_ERR_PTR_INVALID        if you passed a NULL pointer for 'p_blks'
+*
+* Returns     : The number of memory blocks placed in 'p_blks[]'
+*
+* Note(s)     : 1) The whole run of blocks is unlinked from the free list with interrupts disabled only once, which is
+*                  cheaper than calling OSMemGet() 'n_blks' times.  The time spent in the critical section is still
+*                  proportional to the number of blocks obtained.
+************************************************************************************************************************
+*/
+
+OS_MEM_QTY  OSMemGetN (OS_MEM       *p_mem,
+                       void        **p_blks,
+                       OS_MEM_QTY    n_blks,
+                       OS_OPT        opt,
+                       OS_ERR       *p_err)
+{
+    OS_MEM_QTY   i;
+    OS_MEM_QTY   cnt;
+    void        *p_blk;
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return ((OS_MEM_QTY)0);
+    }
+#endif
+
+#if OS_CFG_ARG_CHK_EN > 0u
+    if (p_mem == (OS_MEM *)0) {                             /* Must point to a valid memory partition                 */
+       *p_err  = OS_ERR_MEM_INVALID_P_MEM;
+        return ((OS_MEM_QTY)0);
+    }
+    if (p_blks == (void **)0) {                             /* Must provide storage for the block pointers            */
+       *p_err  = OS_ERR_PTR_INVALID;
+        return ((OS_MEM_QTY)0);
+    }
+    if (n_blks == (OS_MEM_QTY)0) {                          /* Must ask for at least one block                        */
+       *p_err  = OS_ERR_MEM_INVALID_BLKS;
+        return ((OS_MEM_QTY)0);
+    }
+    switch (opt) {                                          /* Validate 'opt'                                         */
+        case OS_OPT_MEM_ALL:
+        case OS_OPT_MEM_PARTIAL:
+             break;
+
+        default:
+            *p_err = OS_ERR_OPT_INVALID;
+             return ((OS_MEM_QTY)0);
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    cnt = n_blks;
+    if (p_mem->NbrFree < n_blks) {                          /* See if there are enough free memory blocks             */
+        if ((opt == OS_OPT_MEM_ALL) ||
+            (p_mem->NbrFree == (OS_MEM_QTY)0)) {
+            CPU_CRITICAL_EXIT();
+           *p_err = OS_ERR_MEM_NO_FREE_BLKS;                /* No,  Notify caller of empty memory partition           */
+            return ((OS_MEM_QTY)0);
+        }
+        cnt = p_mem->NbrFree;                               /* Partial: hand out whatever is left                     */
+    }
+    p_blk = p_mem->FreeListPtr;
+    for (i = 0u; i < cnt; i++) {                            /* Unlink the run of blocks from the free list            */
+        p_blks[i] = p_blk;
+        p_blk     = *(void **)p_blk;
+    }
+    p_mem->FreeListPtr = p_blk;                             /*      Adjust pointer to new free list                   */
+    p_mem->NbrFree    -= cnt;                               /*      'cnt' less memory blocks in this partition        */
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+    return (cnt);
+}
+
+/*$PAGE*/
+/*
+************************************************************************************************************************
+*                                            RELEASE SEVERAL MEMORY BLOCKS
+*
+* Description : Returns several memory blocks to a partition in a single critical section.
+*
+* Arguments   : p_mem    is a pointer to the memory partition control block
+*
+*               p_blks   is a pointer to an array holding the pointers to the memory blocks being released
+*
+*               n_blks   is the number of memory blocks in 'p_blks[]'
+*
+*               opt      determines what happens when the partition cannot take back all 'n_blks' blocks:
+*
+*                            OS_OPT_MEM_ALL            release ALL 'n_blks' blocks or none at all
+*                            OS_OPT_MEM_PARTIAL        release the first blocks of 'p_blks[]' until the partition is
+*                                                      full
+*
+*               p_err    is a pointer to a variable that will contain an error code returned by this function.
+*
+*                            OS_ERR_NONE               if at least one memory block was inserted into the partition
+*                            OS_ERR_MEM_FULL           if you are returning more blocks than were allocated
+*                            OS_ERR_MEM_INVALID_BLKS   if you passed 0 blocks
+*                            OS_ERR_MEM_INVALID_P_BLK  if one of the entries of 'p_blks[]' is a NULL pointer
+*                            OS_ERR_MEM_INVALID_P_MEM  if you passed a NULL pointer for 'p_mem'
+*                            OS_ERR_OPT_INVALID        if you specified an invalid option
+*                            OS_ERR_PTR_INVALID        if you passed a NULL pointer for 'p_blks'
+*
+* Returns     : The number of memory blocks returned to the partition, always the first entries of 'p_blks[]'
+*
+* Note(s)     : 1) Only the blocks actually accepted by the partition are chained together, and only after the free
+*                  capacity has been checked inside the critical section.  Blocks that are rejected (OS_ERR_MEM_FULL,
+*                  or the tail of 'p_blks[]' in OS_OPT_MEM_PARTIAL mode) are left untouched and still belong to the
+*                  caller.
+************************************************************************************************************************
+*/
+
+OS_MEM_QTY  OSMemPutN (OS_MEM       *p_mem,
+                       void        **p_blks,
+                       OS_MEM_QTY    n_blks,
+                       OS_OPT        opt,
+                       OS_ERR       *p_err)
+{
+    OS_MEM_QTY   i;
+    OS_MEM_QTY   cnt;
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return ((OS_MEM_QTY)0);
+    }
+#endif
+
+#if OS_CFG_ARG_CHK_EN > 0u
+    if (p_mem == (OS_MEM *)0) {                             /* Must point to a valid memory partition                 */
+       *p_err  = OS_ERR_MEM_INVALID_P_MEM;
+        return ((OS_MEM_QTY)0);
+    }
+    if (p_blks == (void **)0) {                             /* Must provide the block pointers                        */
+       *p_err  = OS_ERR_PTR_INVALID;
+        return ((OS_MEM_QTY)0);
+    }
+    if (n_blks == (OS_MEM_QTY)0) {                          /* Must release at least one block                        */
+       *p_err  = OS_ERR_MEM_INVALID_BLKS;
+        return ((OS_MEM_QTY)0);
+    }
+    for (i = 0u; i < n_blks; i++) {
+        if (p_blks[i] == (void *)0) {                       /* Must release valid blocks                              */
+           *p_err  = OS_ERR_MEM_INVALID_P_BLK;
+            return ((OS_MEM_QTY)0);
+        }
+    }
+    switch (opt) {                                          /* Validate 'opt'                                         */
+        case OS_OPT_MEM_ALL:
+        case OS_OPT_MEM_PARTIAL:
+             break;
+
+        default:
+            *p_err = OS_ERR_OPT_INVALID;
+             return ((OS_MEM_QTY)0);
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    cnt = p_mem->NbrMax - p_mem->NbrFree;                   /* Number of blocks the partition can still take back     */
+    if (cnt >= n_blks) {
+        cnt = n_blks;
+    } else if ((opt == OS_OPT_MEM_ALL) ||
+               (cnt == (OS_MEM_QTY)0)) {
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_MEM_FULL;
+        return ((OS_MEM_QTY)0);
+    }
+    for (i = 1u; i < cnt; i++) {                            /* Chain only the blocks that are accepted                */
+        *(void **)p_blks[i - 1u] = p_blks[i];
+    }
+    *(void **)p_blks[cnt - 1u] = p_mem->FreeListPtr;        /* Splice the chain in front of the free block list       */
+    p_mem->FreeListPtr         = p_blks[0];
+    p_mem->NbrFree            += cnt;                       /* 'cnt' more memory blocks in this partition             */
+    CPU_CRITICAL_EXIT();
+   *p_err                      = OS_ERR_NONE;
+    return (cnt);
+}
+
 /*$PAGE*/
 /*
 ************************************************************************************************************************
@@ -141,6 +141,27 @@ void  OSMutexCreate (OS_MUTEX  *p_mutex,
     {
         return;
     }
+#if OS_CFG_TS_EN > 0u
+    p_mutex->TS = (CPU_TS)0;
+#endif
+#if OS_CFG_OBJ_STAT_EN > 0u
+    OS_ObjStatClr(&p_mutex->Stat);
+#endif
+#if OS_CFG_MUTEX_PROFILE_EN > 0u
+    p_mutex->HeldTCBPtr    = (OS_TCB   *)0;
+    p_mutex->HeldNextPtr   = (OS_MUTEX *)0;
+    p_mutex->HeldTS        = (CPU_TS    )0;
+    p_mutex->HoldTimeMax   = (CPU_TS    )0;
+    p_mutex->HoldTimeTotal = (CPU_TS64  )0;
+    p_mutex->HoldCtr       = (OS_CTR    )0;
+    p_mutex->BoostCtr      = (OS_CTR    )0;
+#endif
+#if OS_CFG_MUTEX_CEILING_EN > 0u
+    p_mutex->CeilingPrio    = (OS_PRIO   )OS_PRIO_INIT;     /* 普通互斥量,使用RT-Thread的优先级继承                   */
+    p_mutex->CeilingTCBPtr  = (OS_TCB   *)0;
+    p_mutex->CeilingNextPtr = (OS_MUTEX *)0;
+#endif
+    OS_TRACE_NAME(p_mutex, p_name);
 
 #ifndef PKG_USING_UCOSIII_WRAPPER_TINY
     CPU_CRITICAL_ENTER();
@@ -159,6 +180,72 @@ void  OSMutexCreate (OS_MUTEX  *p_mutex,
 #endif
 }
 
+/*
+************************************************************************************************************************
+*                                        CREATE A MUTEX WITH A PRIORITY CEILING
+*
+* Description: This function creates a mutex that uses the immediate priority ceiling protocol instead of priority
+*              inheritance.  A task that obtains the mutex is raised to 'ceiling_prio' at once and is restored to its
+*              previous priority when it releases the mutex.
+*
+* Arguments  : p_mutex       is a pointer to the mutex to initialize.  Your application is responsible for allocating
+*                            storage for the mutex.
+*
+*              p_name        is a pointer to the name you would like to give the mutex.
+*
+*              ceiling_prio  is the priority ceiling of the mutex.  It must be the highest priority (i.e. the lowest
+*                            number) of all the tasks that will ever pend on the mutex.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE                    if the call was successful
+*                                OS_ERR_PRIO_INVALID            if 'ceiling_prio' is >= OS_CFG_PRIO_MAX-1
+*                                Other                          see OSMutexCreate()
+*
+* Returns    : none
+*
+* Note(s)    : 1) 持有者在获得互斥量之前即被提升到天花板优先级,因此所有优先级不高于天花板的任务都不可能在持有期间
+*                 抢占持有者并在该互斥量上阻塞,OSMutexPend()总是直接获得互斥量,不会进入等待链表,也不会发生优先级
+*                 继承;OSMutexPost()在锁调度器的情况下释放互斥量并恢复优先级,最多只引起一次任务切换.
+*
+*              2) 优先级高于天花板的任务不会被提升,仍然可以使用该互斥量,此时由RT-Thread的优先级继承保证正确性.
+*
+*              3) 同一任务可以同时持有多个天花板互斥量,并且可以按任意顺序释放:任务记录获得第一个天花板互斥量之前的
+*                 优先级及所持有的天花板互斥量,每次释放后持有者的优先级为该优先级与仍持有的天花板中最高者.持有者的
+*                 优先级在持有期间被其他互斥量的优先级继承提升到所有天花板之上时,释放时不会降低其优先级.
+************************************************************************************************************************
+*/
+
+#if OS_CFG_MUTEX_CEILING_EN > 0u
+void  OSMutexCreateCeiling (OS_MUTEX  *p_mutex,
+                            CPU_CHAR  *p_name,
+                            OS_PRIO    ceiling_prio,
+                            OS_ERR    *p_err)
+{
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if OS_CFG_ARG_CHK_EN > 0u
+    if(ceiling_prio >= RT_THREAD_PRIORITY_MAX-1)            /* 天花板不可低于或等于空闲任务优先级                     */
+    {
+        *p_err = OS_ERR_PRIO_INVALID;
+        return;
+    }
+#endif
+
+    OSMutexCreate(p_mutex, p_name, p_err);
+    if(*p_err != OS_ERR_NONE)
+    {
+        return;
+    }
+    p_mutex->CeilingPrio = ceiling_prio;                    /* 互斥量尚未被使用,无需进入临界区                        */
+}
+#endif
+
 /*
 ************************************************************************************************************************
 *                                                   DELETE A MUTEX
@@ -205,6 +292,10 @@ OS_OBJ_QTY  OSMutexDel (OS_MUTEX  *p_mutex,
 {
     rt_err_t rt_err;
     rt_uint32_t pend_mutex_len;
+#if OS_CFG_MUTEX_CEILING_EN > 0u
+    OS_TCB *p_tcb;
+    OS_PRIO prio;
+#endif
 
     CPU_SR_ALLOC();
 
@@ -293,6 +384,25 @@ OS_OBJ_QTY  OSMutexDel (OS_MUTEX  *p_mutex,
     if(*p_err == OS_ERR_NONE)
     {
         CPU_CRITICAL_ENTER();
+#if OS_CFG_MUTEX_CEILING_EN > 0u
+        if(p_mutex->CeilingTCBPtr != (OS_TCB *)0)
+        {
+            /*互斥量被删除时仍被持有,按持有者仍持有的天花板互斥量重新计算其优先级*/
+            p_tcb = p_mutex->CeilingTCBPtr;
+            prio = OS_MutexCeilingRemove(p_mutex);
+            if((p_tcb->Task.current_priority >= DEF_MIN(prio, p_mutex->CeilingPrio)) &&
+               (p_tcb->Task.current_priority != prio))
+            {
+                rt_thread_control(&p_tcb->Task, RT_THREAD_CTRL_CHANGE_PRIORITY, &prio);
+            }
+        }
+#endif
+#if OS_CFG_MUTEX_PROFILE_EN > 0u
+        if(p_mutex->HeldTCBPtr != (OS_TCB *)0)              /* 从持有者的互斥量链表中移除                             */
+        {
+            OS_MutexHeldRemove(p_mutex);
+        }
+#endif
 #ifndef PKG_USING_UCOSIII_WRAPPER_TINY
 #if OS_CFG_DBG_EN > 0u
         OS_MutexDbgListRemove(p_mutex);
@@ -373,10 +483,20 @@ void  OSMutexPend (OS_MUTEX  *p_mutex,
 #if OS_CFG_DBG_EN > 0u && !defined PKG_USING_UCOSIII_WRAPPER_TINY
     rt_thread_t thread;
 #endif
+#if OS_CFG_OBJ_STAT_EN > 0u
+    CPU_BOOLEAN stat_blk;
+    OS_TICK stat_start = 0u;
+#endif
+#if OS_CFG_MUTEX_CEILING_EN > 0u
+    OS_PRIO prio_saved;
+    CPU_BOOLEAN ceiling_boost;
+#endif
 
     CPU_SR_ALLOC();
 
-    CPU_VAL_UNUSED(p_ts);
+    if (p_ts != (CPU_TS *)0) {
+       *p_ts  = (CPU_TS  )0;                                /* Initialize the returned timestamp                      */
+    }
 
 #ifdef OS_SAFETY_CRITICAL
     if (p_err == (OS_ERR *)0) {
@@ -471,11 +591,58 @@ void  OSMutexPend (OS_MUTEX  *p_mutex,
     p_tcb->DbgNamePtr = p_mutex->NamePtr;
     p_mutex->DbgNamePtr = p_tcb->Task.name;
 #endif
+#endif
+#if OS_CFG_MUTEX_PROFILE_EN > 0u
+    if((time != RT_WAITING_NO) && (p_mutex->Mutex.owner != RT_NULL) &&
+       (p_mutex->Mutex.owner->current_priority > p_tcb->Task.current_priority))
+    {
+        p_mutex->BoostCtr++;                                /* 持有者优先级低于当前任务,将引起优先级继承              */
+    }
+#endif
+#if OS_CFG_OBJ_STAT_EN > 0u
+    p_mutex->Stat.PendCtr++;
+    stat_blk = DEF_FALSE;
+    if((time != RT_WAITING_NO) && ((p_mutex->Mutex.owner != RT_NULL) && (p_mutex->Mutex.owner != rt_thread_self())))
+    {
+        stat_blk = DEF_TRUE;                                /* 资源不可用,需要阻塞(慢速路径)                          */
+        stat_start = OS_ObjStatPendBlock(&p_mutex->Stat);
+    }
 #endif
     CPU_CRITICAL_EXIT();
 
+#if OS_CFG_MUTEX_CEILING_EN > 0u
+    prio_saved = p_tcb->Task.current_priority;
+    ceiling_boost = DEF_FALSE;
+    if((p_mutex->CeilingPrio < prio_saved) && (p_mutex->Mutex.owner != &p_tcb->Task))
+    {
+        ceiling_boost = DEF_TRUE;                           /* 获得互斥量之前先提升到天花板优先级                     */
+        rt_thread_control(&p_tcb->Task, RT_THREAD_CTRL_CHANGE_PRIORITY, &p_mutex->CeilingPrio);
+    }
+#endif
+    OS_TRACE(OS_TRACE_EV_MUTEX_PEND, p_mutex, timeout);
     rt_err = rt_mutex_take(&p_mutex->Mutex,time);
     *p_err = rt_err_to_ucosiii(rt_err);
+    OS_TRACE(OS_TRACE_EV_MUTEX_PEND_EXIT, p_mutex, *p_err);
+#if OS_CFG_MUTEX_CEILING_EN > 0u
+    if((rt_err == RT_EOK) && (p_mutex->CeilingPrio != (OS_PRIO)OS_PRIO_INIT) && (p_mutex->Mutex.hold == 1u))
+    {
+        CPU_CRITICAL_ENTER();
+        OS_MutexCeilingAdd(p_mutex, p_tcb, prio_saved);     /* 记入持有者的天花板互斥量链表                           */
+        CPU_CRITICAL_EXIT();
+    }
+    else if((ceiling_boost == DEF_TRUE) && (rt_err != RT_EOK) &&
+            (p_tcb->Task.current_priority == p_mutex->CeilingPrio))
+    {
+        /*未获得互斥量,撤销提升*/
+        rt_thread_control(&p_tcb->Task, RT_THREAD_CTRL_CHANGE_PRIORITY, &prio_saved);
+    }
+#endif
+#if OS_CFG_OBJ_STAT_EN > 0u
+    if(stat_blk == DEF_TRUE)
+    {
+        OS_ObjStatPendEnd(&p_mutex->Stat, stat_start, p_tcb, *p_err);
+    }
+#endif
     if(*p_err == OS_ERR_TIMEOUT && time == RT_WAITING_NO)
     {
         *p_err = OS_ERR_PEND_WOULD_BLOCK;
@@ -503,6 +670,12 @@ void  OSMutexPend (OS_MUTEX  *p_mutex,
         p_mutex->DbgNamePtr =(CPU_CHAR *)((void *)" ");     /* 若为空,则清空当前.DbgNamePtr                           */
     }
 #endif
+#endif
+#if OS_CFG_MUTEX_PROFILE_EN > 0u
+    if((rt_err == RT_EOK) && (p_mutex->Mutex.hold == 1u))   /* 最外层获得互斥量,开始计时                              */
+    {
+        OS_MutexHeldAdd(p_mutex, p_tcb);
+    }
 #endif
     if(p_tcb->PendStatus == OS_STATUS_PEND_ABORT)           /* Indicate that we aborted                               */
     {
@@ -518,6 +691,12 @@ void  OSMutexPend (OS_MUTEX  *p_mutex,
         return;
     }
 
+#if OS_CFG_TS_EN > 0u
+    if(rt_err == RT_EOK && p_ts != (CPU_TS *)0)
+    {
+       *p_ts = p_mutex->TS;                                 /* 返回互斥量被释放时的时间戳                             */
+    }
+#endif
     CPU_CRITICAL_EXIT();
 }
 
@@ -705,6 +884,9 @@ void  OSMutexPost (OS_MUTEX  *p_mutex,
 #if OS_CFG_DBG_EN > 0u && !defined PKG_USING_UCOSIII_WRAPPER_TINY
     rt_thread_t thread;
 #endif
+#if OS_CFG_MUTEX_CEILING_EN > 0u
+    OS_PRIO prio_saved;
+#endif
 
     CPU_SR_ALLOC();
 
@@ -756,8 +938,53 @@ void  OSMutexPost (OS_MUTEX  *p_mutex,
     }
 #endif
 
+    OS_TRACE(OS_TRACE_EV_MUTEX_POST, p_mutex, opt);
+
+#if OS_CFG_TS_EN > 0u
+    if(p_mutex->Mutex.owner == rt_thread_self())            /* 先记录时间戳,被唤醒的任务可能立即运行                  */
+    {
+        p_mutex->TS = OS_PostTS();
+    }
+#endif
+#if OS_CFG_MUTEX_PROFILE_EN > 0u
+    CPU_CRITICAL_ENTER();
+    if((p_mutex->Mutex.owner == rt_thread_self()) &&
+       (p_mutex->Mutex.hold == 1u) &&                       /* 最外层释放,结束计时                                    */
+       (p_mutex->HeldTCBPtr != (OS_TCB *)0))
+    {
+        OS_MutexHeldRemove(p_mutex);
+    }
+    CPU_CRITICAL_EXIT();
+#endif
+#if OS_CFG_MUTEX_CEILING_EN > 0u
+    prio_saved = (OS_PRIO)OS_PRIO_INIT;
+    CPU_CRITICAL_ENTER();
+    if((p_mutex->Mutex.owner == rt_thread_self()) &&
+       (p_mutex->Mutex.hold == 1u) &&                       /* 最外层释放,按仍持有的天花板重新计算优先级              */
+       (p_mutex->CeilingTCBPtr != (OS_TCB *)0))
+    {
+        prio_saved = OS_MutexCeilingRemove(p_mutex);
+    }
+    CPU_CRITICAL_EXIT();
+    if(prio_saved != (OS_PRIO)OS_PRIO_INIT)
+    {
+        rt_enter_critical();                                /* 释放与恢复优先级完成后只调度一次                       */
+    }
+#endif
     rt_err = rt_mutex_release(&p_mutex->Mutex);
     *p_err = rt_err_to_ucosiii(rt_err);
+#if OS_CFG_MUTEX_CEILING_EN > 0u
+    if(prio_saved != (OS_PRIO)OS_PRIO_INIT)
+    {
+        if((rt_thread_self()->current_priority >= DEF_MIN(prio_saved, p_mutex->CeilingPrio)) &&
+           (rt_thread_self()->current_priority != prio_saved))
+        {
+            /*释放顺序与获得顺序不同时,rt_mutex_release()可能已将优先级改为其他值,在此一并修正*/
+            rt_thread_control(rt_thread_self(), RT_THREAD_CTRL_CHANGE_PRIORITY, &prio_saved);
+        }
+        rt_exit_critical();
+    }
+#endif
     /*只有已经拥有互斥量控制权的线程才能释放*/
     if(rt_err == -RT_ERROR)                                 /* rt_mutex_release返回-RT_ERROR表示该线程非掌握互斥量的线程*/
     {
@@ -791,6 +1018,136 @@ void  OSMutexPost (OS_MUTEX  *p_mutex,
     CPU_CRITICAL_EXIT();
 }
 
+#if OS_CFG_MUTEX_PROFILE_EN > 0u
+/*
+************************************************************************************************************************
+*                                      ADD/REMOVE MUTEX TO/FROM THE OWNER'S HELD LIST
+*
+* Description: OS_MutexHeldAdd() is called by OSMutexPend() when a task obtains a mutex at the outermost nesting level.
+*              It starts timing the hold and links the mutex into the list of mutexes held by the task.
+*
+*              OS_MutexHeldRemove() is called when the mutex is released at the outermost nesting level (or deleted, or
+*              its owner is deleted).  It stops timing the hold, updates the hold time statistics and unlinks the mutex.
+*
+* Arguments  : p_mutex     is a pointer to the mutex
+*
+*              p_tcb       is a pointer to the TCB of the task that obtained the mutex
+*
+* Returns    : none
+*
+* Note(s)    : 1) These functions are INTERNAL to uC/OS-III and your application should not call it.
+*
+*              2) 必须在关中断(临界区)内调用.
+************************************************************************************************************************
+*/
+
+void  OS_MutexHeldAdd (OS_MUTEX  *p_mutex,
+                       OS_TCB    *p_tcb)
+{
+    p_mutex->HeldTCBPtr  = p_tcb;
+    p_mutex->HeldNextPtr = p_tcb->MutexHeldPtr;             /* 插入到持有者链表的表头                                 */
+    p_tcb->MutexHeldPtr  = p_mutex;
+    p_mutex->HeldTS      = OS_TS_GET();
+}
+
+
+void  OS_MutexHeldRemove (OS_MUTEX  *p_mutex)
+{
+    OS_MUTEX  **pp_next;
+    CPU_TS      hold_time;
+
+
+    hold_time = OS_TS_GET() - p_mutex->HeldTS;
+    if (p_mutex->HoldTimeMax < hold_time) {
+        p_mutex->HoldTimeMax = hold_time;
+    }
+    p_mutex->HoldTimeTotal += (CPU_TS64)hold_time;
+    p_mutex->HoldCtr++;
+
+    pp_next = &p_mutex->HeldTCBPtr->MutexHeldPtr;           /* 互斥量可以不按获得的顺序释放,因此需要查找              */
+    while (*pp_next != (OS_MUTEX *)0) {
+        if (*pp_next == p_mutex) {
+            *pp_next = p_mutex->HeldNextPtr;
+            break;
+        }
+        pp_next = &(*pp_next)->HeldNextPtr;
+    }
+    p_mutex->HeldTCBPtr  = (OS_TCB   *)0;
+    p_mutex->HeldNextPtr = (OS_MUTEX *)0;
+}
+#endif
+
+#if OS_CFG_MUTEX_CEILING_EN > 0u
+/*
+************************************************************************************************************************
+*                                  ADD/REMOVE CEILING MUTEX TO/FROM THE OWNER'S CEILING LIST
+*
+* Description: OS_MutexCeilingAdd() is called by OSMutexPend() when a task obtains a ceiling mutex at the outermost
+*              nesting level.  It links the mutex into the list of ceiling mutexes held by the task.
+*
+*              OS_MutexCeilingRemove() is called when the mutex is released at the outermost nesting level (or deleted,
+*              or its owner is deleted).  It unlinks the mutex and computes the priority the owner should run at.
+*
+* Arguments  : p_mutex     is a pointer to the mutex
+*
+*              p_tcb       is a pointer to the TCB of the task that obtained the mutex
+*
+*              prio        is the priority of the task before it was raised to the ceiling of 'p_mutex'
+*
+* Returns    : OS_MutexCeilingRemove() returns the base priority of the owner raised to the highest ceiling among the
+*              ceiling mutexes it still holds.
+*
+* Note(s)    : 1) These functions are INTERNAL to uC/OS-III and your application should not call it.
+*
+*              2) 必须在关中断(临界区)内调用.
+*
+*              3) 优先级是按任务而不是按互斥量保存的:任务链表为空时记录'prio'作为基础优先级,天花板不高于基础优先级
+*                 的互斥量不会提升任务,因此不会被记入链表.互斥量可以不按获得的顺序释放.
+************************************************************************************************************************
+*/
+
+void  OS_MutexCeilingAdd (OS_MUTEX  *p_mutex,
+                          OS_TCB    *p_tcb,
+                          OS_PRIO    prio)
+{
+    if (p_tcb->CeilingMutexPtr == (OS_MUTEX *)0) {
+        p_tcb->CeilingBasePrio = prio;                      /* 第一个天花板互斥量,记录基础优先级 (see Note #3)        */
+    }
+    if (p_mutex->CeilingPrio >= p_tcb->CeilingBasePrio) {
+        return;
+    }
+    p_mutex->CeilingTCBPtr  = p_tcb;
+    p_mutex->CeilingNextPtr = p_tcb->CeilingMutexPtr;       /* 插入到持有者链表的表头                                 */
+    p_tcb->CeilingMutexPtr  = p_mutex;
+}
+
+
+OS_PRIO  OS_MutexCeilingRemove (OS_MUTEX  *p_mutex)
+{
+    OS_MUTEX  **pp_next;
+    OS_TCB     *p_tcb;
+    OS_PRIO     prio;
+
+
+    p_tcb   = p_mutex->CeilingTCBPtr;
+    prio    = p_tcb->CeilingBasePrio;
+    pp_next = &p_tcb->CeilingMutexPtr;
+    while (*pp_next != (OS_MUTEX *)0) {
+        if (*pp_next == p_mutex) {
+            *pp_next = p_mutex->CeilingNextPtr;             /* 互斥量可以不按获得的顺序释放 (see Note #3)             */
+            continue;
+        }
+        if (prio > (*pp_next)->CeilingPrio) {
+            prio = (*pp_next)->CeilingPrio;                 /* 仍持有的最高天花板                                     */
+        }
+        pp_next = &(*pp_next)->CeilingNextPtr;
+    }
+    p_mutex->CeilingTCBPtr  = (OS_TCB   *)0;
+    p_mutex->CeilingNextPtr = (OS_MUTEX *)0;
+    return (prio);
+}
+#endif
+
 /*
 ************************************************************************************************************************
 *                                            CLEAR THE CONTENTS OF A MUTEX
@@ -809,6 +1166,11 @@ void  OSMutexPost (OS_MUTEX  *p_mutex,
 
 void  OS_MutexClr (OS_MUTEX  *p_mutex)
 {
+#if OS_CFG_MUTEX_CEILING_EN > 0u
+    p_mutex->CeilingPrio       = (OS_PRIO       )OS_PRIO_INIT;
+    p_mutex->CeilingTCBPtr     = (OS_TCB       *)0;
+    p_mutex->CeilingNextPtr    = (OS_MUTEX     *)0;
+#endif
 #ifndef PKG_USING_UCOSIII_WRAPPER_TINY
 #if (OS_CFG_DBG_EN > 0u)
     p_mutex->NamePtr           = (CPU_CHAR     *)((void *)"?MUTEX");
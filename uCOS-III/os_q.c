@@ -80,49 +80,40 @@
 
 /*
 ************************************************************************************************************************
-*                                               CREATE A MESSAGE QUEUE
+*                                            CREATE A MESSAGE QUEUE (INTERNAL)
 *
-* Description: This function is called by your application to create a message queue.  Message queues MUST be created
-*              before they can be used.
+* Description: OSQCreate()、OSQCreateStatic()、OSQCreateCopy()共用的创建函数.
 *
 * Arguments  : p_q         is a pointer to the message queue
 *
 *              p_name      is a pointer to an ASCII string that will be used to name the message queue
 *
-*              max_qty     indicates the maximum size of the message queue (must be non-zero).  Note that it's also not
-*                          possible to have a size higher than the maximum number of OS_MSGs available.
+*              p_storage   is a pointer to the storage area of the message queue, or a NULL pointer to allocate it
+*                          from the heap (it is then freed by OSQDel())
 *
-*              p_err       is a pointer to a variable that will contain an error code returned by this function.
+*              max_qty     indicates the maximum size of the message queue (must be non-zero).
 *
-*                              OS_ERR_NONE                    the call was successful
-*                              OS_ERR_CREATE_ISR              can't create from an ISR
-*                              OS_ERR_ILLEGAL_CREATE_RUN_TIME if you are trying to create the Queue after you called
-*                                                               OSSafetyCriticalStart().
-*                              OS_ERR_NAME                    if 'p_name' is a NULL pointer
-*                              OS_ERR_OBJ_CREATED             if the message queue has already been created
-*                              OS_ERR_OBJ_PTR_NULL            if you passed a NULL pointer for 'p_q'
-*                              OS_ERR_Q_SIZE                  if the size you specified is 0
-*                            + OS_ERR_MEM_FULL                本函数内部采用了内存堆分配,该错误表示无法分配到内存
-*                          -------------说明-------------
-*                              OS_ERR_XXXX        表示可以继续沿用uCOS-III原版的错误码
-*                            - OS_ERR_XXXX        表示该错误码在本兼容层已经无法使用
-*                            + OS_ERR_RT_XXXX     表示该错误码为新增的RTT专用错误码集
-*                            应用层需要对API返回的错误码判断做出相应的修改
+*              msg_size    is the size (in bytes) of one entry of a copy mode queue, or 0 for a pointer queue
+*
+*              p_err       is a pointer to a variable that will contain an error code returned by this function
+*                          (see OSQCreate(), OSQCreateStatic() and OSQCreateCopy()).
 *
 * Returns    : none
+*
+* Note(s)    : This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
 ************************************************************************************************************************
 */
 
-void  OSQCreate (OS_Q        *p_q,
-                 CPU_CHAR    *p_name,
-                 OS_MSG_QTY   max_qty,
-                 OS_ERR      *p_err)
-
+static  void  OS_QCreate (OS_Q        *p_q,
+                          CPU_CHAR    *p_name,
+                          void        *p_storage,
+                          OS_MSG_QTY   max_qty,
+                          OS_MSG_SIZE  msg_size,
+                          OS_ERR      *p_err)
 {
     rt_err_t    rt_err;
-    rt_size_t   msg_size;
+    rt_size_t   entry_size;
     rt_size_t   pool_size;
-    rt_size_t   msg_header_size;
     void       *p_pool;
 
     CPU_SR_ALLOC();
@@ -159,6 +150,11 @@ void  OSQCreate (OS_Q        *p_q,
         *p_err = OS_ERR_NAME;
         return;
     }
+    if(((CPU_ADDR)p_storage & (sizeof(void *) - 1u)) != 0u) /* 检查存储区指针是否按指针对齐                           */
+    {
+        *p_err = OS_ERR_PTR_INVALID;
+        return;
+    }
     if(max_qty == 0)                                        /* 检查消息队列最大长度是否为0                            */
     {
         *p_err = OS_ERR_Q_SIZE;
@@ -175,31 +171,68 @@ void  OSQCreate (OS_Q        *p_q,
     }
 #endif
 
-    msg_header_size = sizeof(struct _rt_mq_message);        /* sizeof(struct rt_mq_message)                           */
-    msg_size = sizeof(ucos_msg_t);                          /* 消息队列中一条消息的最大长度，单位字节                 */
-    pool_size = (msg_header_size + msg_size) * max_qty;     /* 存放消息的缓冲区大小                                   */
-    p_pool = RT_KERNEL_MALLOC(pool_size);                   /* 分配用于存放消息的缓冲区                               */
-    if(p_pool == RT_NULL)
+    if(msg_size == (OS_MSG_SIZE)0)                          /* 传递指针模式:每条消息为一个ucos_msg_t                  */
     {
-        *p_err = OS_ERR_MEM_FULL;
-        return;
+        entry_size = sizeof(ucos_msg_t);
+        pool_size  = OS_Q_STORAGE_SIZE(max_qty);
+    }
+    else                                                    /* 拷贝模式:每条消息最长msg_size字节                      */
+    {
+        entry_size = msg_size;
+        pool_size  = OS_Q_COPY_STORAGE_SIZE(max_qty, msg_size);
+    }
+
+    if(p_storage == RT_NULL)
+    {
+        p_pool = RT_KERNEL_MALLOC(pool_size);               /* 分配用于存放消息的缓冲区,由OSQDel()释放               */
+        if(p_pool == RT_NULL)
+        {
+            *p_err = OS_ERR_MEM_FULL;
+            return;
+        }
+        p_storage = p_pool;
+    }
+    else
+    {
+        p_pool = RT_NULL;                                   /* 存储区由调用者提供,OSQDel()不得释放                    */
     }
     CPU_CRITICAL_ENTER();
-    p_q->p_pool = p_pool;
+    p_q->p_pool  = p_pool;
+#if OS_CFG_Q_COPY_EN > 0u
+    p_q->MsgSize = msg_size;                                /* 0为传递指针模式,否则为拷贝模式                         */
+#endif
+#if OS_CFG_TS_EN > 0u
+    p_q->TS      = (CPU_TS)0;
+#endif
+#if OS_CFG_Q_PRIO_EN > 0u
+    p_q->PrioEntries = 0u;                                  /* 清空各优先级桶                                         */
+    rt_memset(p_q->PrioCtr,     0, sizeof(p_q->PrioCtr));
+    rt_memset(p_q->PrioTailPtr, 0, sizeof(p_q->PrioTailPtr));
+#endif
     CPU_CRITICAL_EXIT();
 
     rt_err = rt_mq_init(&p_q->Msg,
                         (const char *)p_name,
-                         p_q->p_pool,
-                         msg_size,
+                         p_storage,
+                         entry_size,
                          pool_size,
                          RT_IPC_FLAG_PRIO);
 
     *p_err = rt_err_to_ucosiii(rt_err);
     if(rt_err != RT_EOK)
     {
+        if(p_pool != RT_NULL)
+        {
+            RT_KERNEL_FREE(p_pool);
+            p_q->p_pool = RT_NULL;
+        }
         return;
     }
+#if OS_CFG_OBJ_STAT_EN > 0u
+    OS_ObjStatClr(&p_q->Stat);
+    p_q->MsgQtyMax = (OS_MSG_QTY)0;
+#endif
+    OS_TRACE_NAME(p_q, p_name);
 
 #ifndef PKG_USING_UCOSIII_WRAPPER_TINY
     CPU_CRITICAL_ENTER();
@@ -214,6 +247,187 @@ void  OSQCreate (OS_Q        *p_q,
 #endif
 }
 
+/*
+************************************************************************************************************************
+*                                               CREATE A MESSAGE QUEUE
+*
+* Description: This function is called by your application to create a message queue.  Message queues MUST be created
+*              before they can be used.
+*
+* Arguments  : p_q         is a pointer to the message queue
+*
+*              p_name      is a pointer to an ASCII string that will be used to name the message queue
+*
+*              max_qty     indicates the maximum size of the message queue (must be non-zero).  Note that it's also not
+*                          possible to have a size higher than the maximum number of OS_MSGs available.
+*
+*              p_err       is a pointer to a variable that will contain an error code returned by this function.
+*
+*                              OS_ERR_NONE                    the call was successful
+*                              OS_ERR_CREATE_ISR              can't create from an ISR
+*                              OS_ERR_ILLEGAL_CREATE_RUN_TIME if you are trying to create the Queue after you called
+*                                                               OSSafetyCriticalStart().
+*                              OS_ERR_NAME                    if 'p_name' is a NULL pointer
+*                              OS_ERR_OBJ_CREATED             if the message queue has already been created
+*                              OS_ERR_OBJ_PTR_NULL            if you passed a NULL pointer for 'p_q'
+*                              OS_ERR_Q_SIZE                  if the size you specified is 0
+*                            + OS_ERR_MEM_FULL                本函数内部采用了内存堆分配,该错误表示无法分配到内存
+*                          -------------说明-------------
+*                              OS_ERR_XXXX        表示可以继续沿用uCOS-III原版的错误码
+*                            - OS_ERR_XXXX        表示该错误码在本兼容层已经无法使用
+*                            + OS_ERR_RT_XXXX     表示该错误码为新增的RTT专用错误码集
+*                            应用层需要对API返回的错误码判断做出相应的修改
+*
+* Returns    : none
+************************************************************************************************************************
+*/
+
+void  OSQCreate (OS_Q        *p_q,
+                 CPU_CHAR    *p_name,
+                 OS_MSG_QTY   max_qty,
+                 OS_ERR      *p_err)
+
+{
+    OS_QCreate(p_q, p_name, RT_NULL, max_qty, (OS_MSG_SIZE)0, p_err);
+}
+
+/*
+************************************************************************************************************************
+*                                        CREATE A MESSAGE QUEUE (STATIC STORAGE)
+*
+* Description: This function is called by your application to create a message queue whose message storage is
+*              provided by the caller instead of being allocated from the heap.
+*
+* Arguments  : p_q         is a pointer to the message queue
+*
+*              p_name      is a pointer to an ASCII string that will be used to name the message queue
+*
+*              p_storage   is a pointer to the storage area of the message queue.  It must be at least
+*                          OS_Q_STORAGE_SIZE(max_qty) bytes and aligned on a pointer boundary, e.g.:
+*
+*                              ALIGN(RT_ALIGN_SIZE)
+*                              static  CPU_INT08U  AppQStorage[OS_Q_STORAGE_SIZE(10)];
+*
+*              max_qty     indicates the maximum size of the message queue (must be non-zero).
+*
+*              p_err       is a pointer to a variable that will contain an error code returned by this function.
+*
+*                              OS_ERR_NONE                    the call was successful
+*                              OS_ERR_CREATE_ISR              can't create from an ISR
+*                              OS_ERR_ILLEGAL_CREATE_RUN_TIME if you are trying to create the Queue after you called
+*                                                               OSSafetyCriticalStart().
+*                              OS_ERR_NAME                    if 'p_name' is a NULL pointer
+*                              OS_ERR_OBJ_CREATED             if the message queue has already been created
+*                              OS_ERR_OBJ_PTR_NULL            if you passed a NULL pointer for 'p_q'
+*                              OS_ERR_PTR_INVALID             if 'p_storage' is a NULL pointer or is not aligned
+*                              OS_ERR_Q_SIZE                  if the size you specified is 0
+*
+* Returns    : none
+*
+* Note(s)    : 1) 本函数不会调用RT_KERNEL_MALLOC,消息队列的全部存储空间均由调用者提供(可以位于.bss段),
+*                 OSQDel()删除该消息队列时也不会释放该存储空间
+************************************************************************************************************************
+*/
+
+void  OSQCreateStatic (OS_Q        *p_q,
+                       CPU_CHAR    *p_name,
+                       void        *p_storage,
+                       OS_MSG_QTY   max_qty,
+                       OS_ERR      *p_err)
+{
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if OS_CFG_ARG_CHK_EN > 0u
+    if(p_storage == RT_NULL)                                /* 存储区必须由调用者提供                                 */
+    {
+        *p_err = OS_ERR_PTR_INVALID;
+        return;
+    }
+#endif
+
+    OS_QCreate(p_q, p_name, p_storage, max_qty, (OS_MSG_SIZE)0, p_err);
+}
+
+/*
+************************************************************************************************************************
+*                                     CREATE A MESSAGE QUEUE THAT COPIES MESSAGES
+*
+* Description: This function is called by your application to create a message queue whose messages are copied by
+*              value into the queue instead of being passed by reference.  Each entry of the queue holds up to
+*              'msg_size' bytes, so the producer does not have to keep the payload alive (e.g. allocate it from an
+*              OS_MEM partition) until the consumer has processed it.
+*
+* Arguments  : p_q         is a pointer to the message queue
+*
+*              p_name      is a pointer to an ASCII string that will be used to name the message queue
+*
+*              p_storage   is a pointer to the storage area of the message queue.  It must be at least
+*                          OS_Q_COPY_STORAGE_SIZE(max_qty, msg_size) bytes and aligned on a pointer boundary.  If you
+*                          pass a NULL pointer, the storage area is allocated from the heap and freed by OSQDel().
+*
+*              max_qty     indicates the maximum size of the message queue (must be non-zero).
+*
+*              msg_size    is the size (in bytes) of one entry of the queue (must be non-zero).
+*
+*              p_err       is a pointer to a variable that will contain an error code returned by this function.
+*
+*                              OS_ERR_NONE                    the call was successful
+*                              OS_ERR_CREATE_ISR              can't create from an ISR
+*                              OS_ERR_ILLEGAL_CREATE_RUN_TIME if you are trying to create the Queue after you called
+*                                                               OSSafetyCriticalStart().
+*                              OS_ERR_NAME                    if 'p_name' is a NULL pointer
+*                              OS_ERR_OBJ_CREATED             if the message queue has already been created
+*                              OS_ERR_OBJ_PTR_NULL            if you passed a NULL pointer for 'p_q'
+*                              OS_ERR_PTR_INVALID             if 'p_storage' is not aligned
+*                              OS_ERR_Q_SIZE                  if the size you specified is 0
+*                            + OS_ERR_Q_MSG_SIZE              if 'msg_size' is 0
+*                            + OS_ERR_MEM_FULL                'p_storage'为NULL且无法从内存堆分配到存储区
+*                          -------------说明-------------
+*                              OS_ERR_XXXX        表示可以继续沿用uCOS-III原版的错误码
+*                            - OS_ERR_XXXX        表示该错误码在本兼容层已经无法使用
+*                            + OS_ERR_RT_XXXX     表示该错误码为新增的RTT专用错误码集
+*                            应用层需要对API返回的错误码判断做出相应的修改
+*
+* Returns    : none
+*
+* Note(s)    : 1) 该函数为兼容层新增函数,原版uCOS-III没有该函数
+*              2) 以该函数创建的消息队列只能使用OSQPostCopy()/OSQPendCopy()收发消息,
+*                 OSQPost()/OSQPend()将返回OS_ERR_OBJ_TYPE
+************************************************************************************************************************
+*/
+
+#if OS_CFG_Q_COPY_EN > 0u
+void  OSQCreateCopy (OS_Q        *p_q,
+                     CPU_CHAR    *p_name,
+                     void        *p_storage,
+                     OS_MSG_QTY   max_qty,
+                     OS_MSG_SIZE  msg_size,
+                     OS_ERR      *p_err)
+{
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if OS_CFG_ARG_CHK_EN > 0u
+    if(msg_size == 0)                                       /* 检查消息长度是否为0                                    */
+    {
+        *p_err = OS_ERR_Q_MSG_SIZE;
+        return;
+    }
+#endif
+
+    OS_QCreate(p_q, p_name, p_storage, max_qty, msg_size, p_err);
+}
+#endif
+
 /*
 ************************************************************************************************************************
 *                                               DELETE A MESSAGE QUEUE
@@ -347,7 +561,11 @@ OS_OBJ_QTY  OSQDel (OS_Q    *p_q,
 
     if(*p_err == OS_ERR_NONE)
     {
-        RT_KERNEL_FREE(p_q->p_pool);
+        if(p_q->p_pool != RT_NULL)                          /* 静态创建的消息队列存储区由调用者管理                   */
+        {
+            RT_KERNEL_FREE(p_q->p_pool);
+            p_q->p_pool = RT_NULL;
+        }
         CPU_CRITICAL_ENTER();
 #ifndef PKG_USING_UCOSIII_WRAPPER_TINY
 #if OS_CFG_DBG_EN > 0u
@@ -523,10 +741,16 @@ void  *OSQPend (OS_Q         *p_q,
 #if OS_CFG_DBG_EN > 0u && !defined PKG_USING_UCOSIII_WRAPPER_TINY
     rt_thread_t thread;
 #endif
+#if OS_CFG_OBJ_STAT_EN > 0u
+    CPU_BOOLEAN stat_blk;
+    OS_TICK stat_start = 0u;
+#endif
 
     CPU_SR_ALLOC();
 
-    CPU_VAL_UNUSED(p_ts);
+    if (p_ts != (CPU_TS *)0) {
+       *p_ts  = (CPU_TS  )0;                                /* Initialize the returned timestamp                      */
+    }
 
 #ifdef OS_SAFETY_CRITICAL
     if (p_err == (OS_ERR *)0) {
@@ -580,6 +804,14 @@ void  *OSQPend (OS_Q         *p_q,
     }
 #endif
 
+#if OS_CFG_Q_COPY_EN > 0u
+    if(p_q->MsgSize != 0u)                                  /* 拷贝模式的消息队列必须使用OSQPendCopy()                */
+    {
+        *p_err = OS_ERR_OBJ_TYPE;
+        return RT_NULL;
+    }
+#endif
+
     /*
         在RTT中timeout为0表示不阻塞,为RT_WAITING_FOREVER表示永久阻塞,
         这与uCOS-III有所不同,因此需要转换
@@ -617,16 +849,33 @@ void  *OSQPend (OS_Q         *p_q,
 #if OS_CFG_DBG_EN > 0u && !defined PKG_USING_UCOSIII_WRAPPER_TINY
     p_tcb->DbgNamePtr = p_q->NamePtr;
     p_q->DbgNamePtr = p_tcb->Task.name;
+#endif
+#if OS_CFG_OBJ_STAT_EN > 0u
+    p_q->Stat.PendCtr++;
+    stat_blk = DEF_FALSE;
+    if((time != RT_WAITING_NO) && (p_q->Msg.entry == 0u))
+    {
+        stat_blk = DEF_TRUE;                                /* 资源不可用,需要阻塞(慢速路径)                          */
+        stat_start = OS_ObjStatPendBlock(&p_q->Stat);
+    }
 #endif
     CPU_CRITICAL_EXIT();
 
     /*开始消息接收以及处理*/
+    OS_TRACE(OS_TRACE_EV_Q_PEND, p_q, timeout);
     rt_err = rt_mq_recv(&p_q->Msg,
                         (void*)&ucos_msg,                   /* uCOS消息段                                             */
                          sizeof(ucos_msg_t),                /* uCOS消息段长度                                         */
                          time);
 
     *p_err = rt_err_to_ucosiii(rt_err);
+    OS_TRACE(OS_TRACE_EV_Q_PEND_EXIT, p_q, *p_err);
+#if OS_CFG_OBJ_STAT_EN > 0u
+    if(stat_blk == DEF_TRUE)
+    {
+        OS_ObjStatPendEnd(&p_q->Stat, stat_start, p_tcb, *p_err);
+    }
+#endif
     if(*p_err == OS_ERR_TIMEOUT && time == RT_WAITING_NO)
     {
         *p_err = OS_ERR_PEND_WOULD_BLOCK;
@@ -659,6 +908,12 @@ void  *OSQPend (OS_Q         *p_q,
 
     if(*p_err == OS_ERR_NONE)
     {
+#if OS_CFG_TS_EN > 0u
+        if(p_ts != (CPU_TS *)0)
+        {
+           *p_ts = ucos_msg.ts;                             /* 返回该消息被发布时的时间戳                             */
+        }
+#endif
         *p_msg_size = ucos_msg.data_size;
         return ucos_msg.data_ptr;
     }
@@ -856,6 +1111,8 @@ OS_OBJ_QTY  OSQPendAbort (OS_Q    *p_q,
 *                              应用层需要对API返回的错误码判断做出相应的修改
 *
 * Returns    : None
+*
+* Note(s)    : 1) 使能OS_CFG_Q_PRIO_EN时,本函数发送的消息视为最低优先级(OS_CFG_Q_PRIO_LEVELS-1),参见OSQPostPrio()
 ************************************************************************************************************************
 */
 
@@ -867,6 +1124,9 @@ void  OSQPost (OS_Q         *p_q,
 {
     rt_err_t rt_err;
     ucos_msg_t  ucos_msg;
+#if OS_CFG_Q_PRIO_EN > 0u
+    rt_uint32_t waiting;
+#endif
 #if OS_CFG_DBG_EN > 0u && !defined PKG_USING_UCOSIII_WRAPPER_TINY
     rt_thread_t thread;
 #endif
@@ -919,10 +1179,62 @@ void  OSQPost (OS_Q         *p_q,
     }
 #endif
 
+#if OS_CFG_Q_COPY_EN > 0u
+    if(p_q->MsgSize != 0u)                                  /* 拷贝模式的消息队列必须使用OSQPostCopy()                */
+    {
+        *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    OS_TRACE(OS_TRACE_EV_Q_POST, p_q, msg_size);
+
+#if OS_CFG_ISR_POST_DEFERRED_EN > 0u
+    if (OSIntNestingCtr > (OS_NESTING_CTR)0) {              /* See if called from an ISR                              */
+        OS_IntQPost((OS_OBJ_TYPE)OS_OBJ_TYPE_Q,             /* Post to ISR queue                                      */
+                    (void      *)p_q,
+                    (void      *)p_void,
+                    (OS_MSG_SIZE)msg_size,
+                    (OS_FLAGS   )0,
+                    (OS_PRIO    )0,
+                    (OS_OPT     )opt,
+                    (CPU_TS     )OS_TS_GET(),
+                    (OS_ERR    *)p_err);
+        return;
+    }
+#endif
+
     /*装填uCOS消息段*/
     ucos_msg.data_size = msg_size;
     ucos_msg.data_ptr = p_void;
+#if OS_CFG_TS_EN > 0u
+    ucos_msg.ts = OS_PostTS();                              /* 每条消息携带自己的发布时间戳                           */
+    p_q->TS = ucos_msg.ts;
+#endif
 
+#if OS_CFG_Q_PRIO_EN > 0u
+    /*
+        消息按优先级排序时,所有消息都必须经过OS_QPrioPost()插入,以便维护各优先级桶:
+        FIFO消息视为最低优先级,追加到队尾;LIFO消息插到队头(即最高优先级桶的头部)
+    */
+    if((opt & OS_OPT_POST_ALL) == 0u)
+    {
+        rt_err = OS_QPrioPost(p_q, &ucos_msg, (OS_PRIO)(OS_CFG_Q_PRIO_LEVELS - 1u), opt);
+    }
+    else
+    {
+        /* 广播:为每个等待的任务各插入一条相同的消息,锁住调度器保证这些任务同时就绪 */
+        rt_err = RT_EOK;
+        rt_enter_critical();
+        waiting = rt_list_len(&(p_q->Msg.parent.suspend_thread));
+        while(waiting > 0u && rt_err == RT_EOK)
+        {
+            rt_err = OS_QPrioPost(p_q, &ucos_msg, (OS_PRIO)(OS_CFG_Q_PRIO_LEVELS - 1u), opt);
+            waiting--;
+        }
+        rt_exit_critical();
+    }
+#else
     if((opt & OS_OPT_POST_LIFO) == 0u) /* FIFO */
     {
         if((opt & OS_OPT_POST_ALL) == 0u)
@@ -946,6 +1258,7 @@ void  OSQPost (OS_Q         *p_q,
             rt_err = rt_mq_send_all(&p_q->Msg,(void*)&ucos_msg,sizeof(ucos_msg_t));
         }
     }
+#endif
     if(rt_err == -RT_EFULL)
     {
         *p_err = OS_ERR_MSG_POOL_EMPTY;
@@ -956,6 +1269,12 @@ void  OSQPost (OS_Q         *p_q,
     }
 
     CPU_CRITICAL_ENTER();
+#if OS_CFG_OBJ_STAT_EN > 0u
+    if(p_q->MsgQtyMax < (OS_MSG_QTY)p_q->Msg.entry)         /* 记录队列中消息数的峰值                                 */
+    {
+        p_q->MsgQtyMax = (OS_MSG_QTY)p_q->Msg.entry;
+    }
+#endif
 #if OS_CFG_DBG_EN > 0u && !defined PKG_USING_UCOSIII_WRAPPER_TINY
     if(!rt_list_isempty(&(p_q->Msg.parent.suspend_thread)))
     {
@@ -973,29 +1292,771 @@ void  OSQPost (OS_Q         *p_q,
 
 /*
 ************************************************************************************************************************
-*                                        CLEAR THE CONTENTS OF A MESSAGE QUEUE
+*                                       POST MESSAGE TO A QUEUE WITH A PRIORITY
 *
-* Description: This function is called by OSQDel() to clear the contents of a message queue
+* Description: This function sends a message to a queue.  Messages are kept sorted by message priority: OSQPend() always
+*              returns the oldest message of the highest priority present in the queue.
 *
-
-* Argument(s): p_q      is a pointer to the queue to clear
-*              ---
+* Arguments  : p_q           is a pointer to a message queue that must have been created by OSQCreate() or
+*                            OSQCreateStatic().
 *
-* Returns    : none
+*              p_void        is a pointer to the message to send.
 *
-* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*              msg_size      specifies the size of the message (in bytes)
+*
+*              prio          is the priority of the message.  0 is the highest priority and OS_CFG_Q_PRIO_LEVELS-1 the
+*                            lowest.  Messages sent with OSQPost() are given the lowest priority.
+*
+*              opt           determines the type of POST performed:
+*
+*                                OS_OPT_POST_FIFO         POST message after all messages of the same (or a higher)
+*                                                         priority and wake up a single waiting task.
+*                              - OS_OPT_POST_NO_SCHED     Do not call the scheduler
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE            The call was successful and the message was sent
+*                                OS_ERR_MSG_POOL_EMPTY  If the queue is full
+*                                OS_ERR_OBJ_PTR_NULL    If 'p_q' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE        If the message queue was not initialized or was created by
+*                                                       OSQCreateCopy()
+*                                OS_ERR_OPT_INVALID     You specified an invalid option
+*                                OS_ERR_OS_NOT_RUNNING  If uC/OS-III is not running yet
+*                                OS_ERR_PRIO_INVALID    If 'prio' is not lower than OS_CFG_Q_PRIO_LEVELS
+*
+* Returns    : None
+*
+* Note(s)    : 1) 该函数为兼容层新增函数,原版uCOS-III没有该函数.可以在中断中调用
+*              2) 消息仍然存放在RTT消息队列的链表中,兼容层为每个优先级记录消息数及最后一条消息(优先级桶),
+*                 插入时只需找到不低于该优先级的最近非空桶的队尾,时间复杂度只与OS_CFG_Q_PRIO_LEVELS有关,与队列长度无关
+*              3) 使能OS_CFG_ISR_POST_DEFERRED_EN时,在中断中调用只会将发布请求(包括优先级)写入中断队列,由中断处理任务
+*                 按先后顺序重新发布,因此不会越过此前中断中的OSQPost(),也不会在关中断期间处理优先级桶
 ************************************************************************************************************************
 */
-void  OS_QClr (OS_Q  *p_q)
+
+#if OS_CFG_Q_PRIO_EN > 0u
+void  OSQPostPrio (OS_Q         *p_q,
+                   void         *p_void,
+                   OS_MSG_SIZE   msg_size,
+                   OS_PRIO       prio,
+                   OS_OPT        opt,
+                   OS_ERR       *p_err)
 {
-#ifndef PKG_USING_UCOSIII_WRAPPER_TINY
-    p_q->Type    =  OS_OBJ_TYPE_NONE;                       /* Mark the data structure as a NONE                      */
-#endif
-#if OS_CFG_DBG_EN > 0u && !defined PKG_USING_UCOSIII_WRAPPER_TINY
+    rt_err_t rt_err;
+    ucos_msg_t  ucos_msg;
+#if OS_CFG_DBG_EN > 0u && !defined PKG_USING_UCOSIII_WRAPPER_TINY
+    rt_thread_t thread;
+#endif
+
+    CPU_SR_ALLOC();
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                 /* Is the kernel running?                                 */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return;
+    }
+#endif
+
+#if OS_CFG_ARG_CHK_EN > 0u
+    if(p_q == RT_NULL)                                      /* 检查消息队列指针是否为NULL                             */
+    {
+        *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    if(prio >= (OS_PRIO)OS_CFG_Q_PRIO_LEVELS)               /* 检查消息优先级是否合法                                 */
+    {
+        *p_err = OS_ERR_PRIO_INVALID;
+        return;
+    }
+    switch (opt) {
+        case OS_OPT_POST_FIFO:
+        case OS_OPT_POST_FIFO | OS_OPT_POST_NO_SCHED:
+             break;
+
+        default:
+            *p_err =  OS_ERR_OPT_INVALID;
+             return;
+    }
+#endif
+
+#if OS_CFG_OBJ_TYPE_CHK_EN > 0u
+    /*判断内核对象是否为消息队列*/
+    if(rt_object_get_type(&p_q->Msg.parent.parent) != RT_Object_Class_MessageQueue)
+    {
+        *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+#if OS_CFG_Q_COPY_EN > 0u
+    if(p_q->MsgSize != 0u)                                  /* 拷贝模式的消息队列不支持按优先级发送                   */
+    {
+        *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    OS_TRACE(OS_TRACE_EV_Q_POST, p_q, msg_size);
+
+#if OS_CFG_ISR_POST_DEFERRED_EN > 0u
+    if (OSIntNestingCtr > (OS_NESTING_CTR)0) {              /* See if called from an ISR (see Note #3)                */
+        OS_IntQPost((OS_OBJ_TYPE)OS_OBJ_TYPE_Q_PRIO,        /* Post to ISR queue                                      */
+                    (void      *)p_q,
+                    (void      *)p_void,
+                    (OS_MSG_SIZE)msg_size,
+                    (OS_FLAGS   )0,
+                    (OS_PRIO    )prio,
+                    (OS_OPT     )opt,
+                    (CPU_TS     )OS_TS_GET(),
+                    (OS_ERR    *)p_err);
+        return;
+    }
+#endif
+
+    /*装填uCOS消息段*/
+    ucos_msg.data_size = msg_size;
+    ucos_msg.data_ptr = p_void;
+#if OS_CFG_TS_EN > 0u
+    ucos_msg.ts = OS_PostTS();                              /* 每条消息携带自己的发布时间戳                           */
+    p_q->TS = ucos_msg.ts;
+#endif
+
+    rt_err = OS_QPrioPost(p_q, &ucos_msg, prio, opt);
+    if(rt_err == -RT_EFULL)
+    {
+        *p_err = OS_ERR_MSG_POOL_EMPTY;
+    }
+    else
+    {
+        *p_err = rt_err_to_ucosiii(rt_err);
+    }
+
+    CPU_CRITICAL_ENTER();
+#if OS_CFG_OBJ_STAT_EN > 0u
+    if(p_q->MsgQtyMax < (OS_MSG_QTY)p_q->Msg.entry)         /* 记录队列中消息数的峰值                                 */
+    {
+        p_q->MsgQtyMax = (OS_MSG_QTY)p_q->Msg.entry;
+    }
+#endif
+#if OS_CFG_DBG_EN > 0u && !defined PKG_USING_UCOSIII_WRAPPER_TINY
+    if(!rt_list_isempty(&(p_q->Msg.parent.suspend_thread)))
+    {
+        /*若等待表不为空，则将当前等待消息队列的线程赋值给.DbgNamePtr*/
+        thread = rt_list_entry((&(p_q->Msg.parent.suspend_thread))->next, struct rt_thread, tlist);
+        p_q->DbgNamePtr = thread->name;
+    }
+    else
+    {
+        p_q->DbgNamePtr = (CPU_CHAR *)((void *)" ");        /* 若为空,则清空当前.DbgNamePtr                           */
+    }
+#endif
+    CPU_CRITICAL_EXIT();
+}
+#endif
+
+/*
+************************************************************************************************************************
+*                                       PEND ON A QUEUE FOR A MESSAGE (COPY MODE)
+*
+* Description: This function waits for a message to be sent to a queue created by OSQCreateCopy() and copies the
+*              message into the caller's buffer.
+*
+* Arguments  : p_q           is a pointer to the message queue
+*
+*              p_buf         is a pointer to the buffer that will receive the message
+*
+*              buf_size      is the size of 'p_buf' (in bytes).  It must be at least the element size of the queue.
+*
+*              timeout       is an optional timeout period (in clock ticks).  If non-zero, your task will wait for a
+*                            message to arrive at the queue up to the amount of time specified by this argument.  If you
+*                            specify 0, however, your task will wait forever at the specified queue or, until a message
+*                            arrives.
+*
+*              opt           determines whether the user wants to block if the queue is empty or not:
+*
+*                                OS_OPT_PEND_BLOCKING
+*                                OS_OPT_PEND_NON_BLOCKING
+*
+*              p_msg_size    is a pointer to a variable that will receive the number of bytes copied into 'p_buf'.
+*                            A NULL pointer can be specified if the size is not needed.
+*
+*              p_ts          is a pointer to a variable that will receive the timestamp of when the message was
+*                            received.
+*                            -------------说明-------------
+*                            该参数在RTT中没有意义,填NULL即可
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE               The call was successful and your task received a message.
+*                                OS_ERR_OBJ_PTR_NULL       if you pass a NULL pointer for 'p_q'
+*                                OS_ERR_OBJ_TYPE           if the message queue was not created by OSQCreateCopy()
+*                                OS_ERR_OS_NOT_RUNNING     If uC/OS-III is not running yet
+*                                OS_ERR_PEND_ABORT         the pend was aborted
+*                                OS_ERR_PEND_ISR           if you called this function from an ISR
+*                                OS_ERR_PEND_WOULD_BLOCK   If you specified non-blocking but the queue was empty
+*                                OS_ERR_PTR_INVALID        if you passed a NULL pointer for 'p_buf'
+*                                OS_ERR_SCHED_LOCKED       the scheduler is locked
+*                                OS_ERR_TIMEOUT            A message was not received within the specified timeout
+*                              + OS_ERR_Q_MSG_SIZE         if 'buf_size' is smaller than the element size of the queue
+*                            -------------说明-------------
+*                                OS_ERR_XXXX        表示可以继续沿用uCOS-III原版的错误码
+*                              - OS_ERR_XXXX        表示该错误码在本兼容层已经无法使用
+*                              + OS_ERR_RT_XXXX     表示该错误码为新增的RTT专用错误码集
+*                              应用层需要对API返回的错误码判断做出相应的修改
+*
+* Returns    : none
+*
+* Note(s)    : 1) 该函数为兼容层新增函数,原版uCOS-III没有该函数
+*              2) RTT消息队列不记录每条消息的实际长度,因此'p_msg_size'返回的始终是元素长度;
+*                 若发送方写入的字节数小于元素长度,多出部分的内容是不确定的,变长消息需自行在消息中携带长度
+************************************************************************************************************************
+*/
+
+#if OS_CFG_Q_COPY_EN > 0u
+void  OSQPendCopy (OS_Q         *p_q,
+                   void         *p_buf,
+                   OS_MSG_SIZE   buf_size,
+                   OS_TICK       timeout,
+                   OS_OPT        opt,
+                   OS_MSG_SIZE  *p_msg_size,
+                   CPU_TS       *p_ts,
+                   OS_ERR       *p_err)
+{
+    rt_err_t    rt_err;
+    rt_int32_t  time;
+    OS_TCB     *p_tcb;
+#if OS_CFG_DBG_EN > 0u && !defined PKG_USING_UCOSIII_WRAPPER_TINY
+    rt_thread_t thread;
+#endif
+#if OS_CFG_OBJ_STAT_EN > 0u
+    CPU_BOOLEAN stat_blk;
+    OS_TICK stat_start = 0u;
+#endif
+
+    CPU_SR_ALLOC();
+
+    if (p_ts != (CPU_TS *)0) {
+       *p_ts  = (CPU_TS  )0;                                /* Initialize the returned timestamp                      */
+    }
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+    if (p_msg_size != (OS_MSG_SIZE *)0) {
+       *p_msg_size = 0u;
+    }
+
+#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u
+    if(OSIntNestingCtr > (OS_NESTING_CTR)0)                 /* 检查是否在中断中运行                                   */
+    {
+        *p_err = OS_ERR_PEND_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                 /* Is the kernel running?                                 */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return;
+    }
+#endif
+
+#if OS_CFG_ARG_CHK_EN > 0u
+    if(p_q == RT_NULL)                                      /* 检查消息队列指针是否为NULL                             */
+    {
+        *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    if(p_buf == RT_NULL)                                    /* 检查接收缓冲区指针是否为NULL                           */
+    {
+        *p_err = OS_ERR_PTR_INVALID;
+        return;
+    }
+    switch (opt) {
+        case OS_OPT_PEND_BLOCKING:
+        case OS_OPT_PEND_NON_BLOCKING:
+             break;
+
+        default:
+            *p_err = OS_ERR_OPT_INVALID;
+             return;
+    }
+#endif
+
+#if OS_CFG_OBJ_TYPE_CHK_EN > 0u
+    /*判断内核对象是否为消息队列*/
+    if(rt_object_get_type(&p_q->Msg.parent.parent) != RT_Object_Class_MessageQueue)
+    {
+        *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    if(p_q->MsgSize == 0u)                                  /* 传递指针模式的消息队列不能拷贝收发,始终检查            */
+    {
+        *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+
+    if(buf_size < p_q->MsgSize)                             /* 接收缓冲区必须能容纳一个完整的元素                     */
+    {
+        *p_err = OS_ERR_Q_MSG_SIZE;
+        return;
+    }
+
+    /*
+        在RTT中timeout为0表示不阻塞,为RT_WAITING_FOREVER表示永久阻塞,
+        这与uCOS-III有所不同,因此需要转换
+    */
+    if((opt & OS_OPT_PEND_NON_BLOCKING) == (OS_OPT)0)
+    {
+        /*检查调度器是否被锁*/
+        if(OSSchedLockNestingCtr > (OS_NESTING_CTR)0)
+        {
+            *p_err = OS_ERR_SCHED_LOCKED;
+            return;
+        }
+        if(timeout == 0)                                    /* 在uCOS-III中timeout=0表示永久阻塞                      */
+        {
+            time = RT_WAITING_FOREVER;
+        }
+        else
+        {
+            time = timeout;
+        }
+    }
+    else
+    {
+        time = RT_WAITING_NO;                               /* 在RTT中timeout为0表示非阻塞                            */
+    }
+
+    CPU_CRITICAL_ENTER();
+    p_tcb = OSTCBCurPtr;
+    p_tcb->PendStatus = OS_STATUS_PEND_OK;                  /* Clear pend status                                      */
+    p_tcb->TaskState |= OS_TASK_STATE_PEND;
+    p_tcb->PendOn = OS_TASK_PEND_ON_Q;
+#if OS_CFG_DBG_EN > 0u && !defined PKG_USING_UCOSIII_WRAPPER_TINY
+    p_tcb->DbgNamePtr = p_q->NamePtr;
+    p_q->DbgNamePtr = p_tcb->Task.name;
+#endif
+#if OS_CFG_OBJ_STAT_EN > 0u
+    p_q->Stat.PendCtr++;
+    stat_blk = DEF_FALSE;
+    if((time != RT_WAITING_NO) && (p_q->Msg.entry == 0u))
+    {
+        stat_blk = DEF_TRUE;                                /* 资源不可用,需要阻塞(慢速路径)                          */
+        stat_start = OS_ObjStatPendBlock(&p_q->Stat);
+    }
+#endif
+    CPU_CRITICAL_EXIT();
+
+    /*消息内容由RTT直接拷贝到接收缓冲区*/
+    OS_TRACE(OS_TRACE_EV_Q_PEND, p_q, timeout);
+    rt_err = rt_mq_recv(&p_q->Msg,
+                         p_buf,
+                         p_q->MsgSize,
+                         time);
+
+    *p_err = rt_err_to_ucosiii(rt_err);
+    OS_TRACE(OS_TRACE_EV_Q_PEND_EXIT, p_q, *p_err);
+#if OS_CFG_OBJ_STAT_EN > 0u
+    if(stat_blk == DEF_TRUE)
+    {
+        OS_ObjStatPendEnd(&p_q->Stat, stat_start, p_tcb, *p_err);
+    }
+#endif
+    if(*p_err == OS_ERR_TIMEOUT && time == RT_WAITING_NO)
+    {
+        *p_err = OS_ERR_PEND_WOULD_BLOCK;
+    }
+
+    CPU_CRITICAL_ENTER();
+    p_tcb->TaskState &= ~OS_TASK_STATE_PEND;                /* 更新任务状态                                           */
+    p_tcb->PendOn = OS_TASK_PEND_ON_NOTHING;                /* 清除当前任务等待状态                                   */
+#if OS_CFG_DBG_EN > 0u && !defined PKG_USING_UCOSIII_WRAPPER_TINY
+    p_tcb->DbgNamePtr = (CPU_CHAR *)((void *)" ");
+    if(!rt_list_isempty(&(p_q->Msg.parent.suspend_thread)))
+    {
+        /*若等待表不为空，则将当前等待消息队列的线程赋值给.DbgNamePtr*/
+        thread = rt_list_entry((&(p_q->Msg.parent.suspend_thread))->next, struct rt_thread, tlist);
+        p_q->DbgNamePtr = thread->name;
+    }
+    else
+    {
+        p_q->DbgNamePtr =(CPU_CHAR *)((void *)" ");         /* 若为空,则清空当前.DbgNamePtr                           */
+    }
+#endif
+    if(p_tcb->PendStatus == OS_STATUS_PEND_ABORT)           /* Indicate that we aborted                               */
+    {
+        CPU_CRITICAL_EXIT();
+        *p_err = OS_ERR_PEND_ABORT;
+        return;
+    }
+    CPU_CRITICAL_EXIT();
+
+    if(*p_err == OS_ERR_NONE && p_msg_size != (OS_MSG_SIZE *)0)
+    {
+        *p_msg_size = p_q->MsgSize;
+    }
+#if OS_CFG_TS_EN > 0u
+    if(*p_err == OS_ERR_NONE && p_ts != (CPU_TS *)0)
+    {
+       *p_ts = p_q->TS;                                     /* 拷贝模式的消息不含时间戳,返回最近一次发布的时间戳      */
+    }
+#endif
+}
+#endif
+
+/*
+************************************************************************************************************************
+*                                         POST MESSAGE TO A QUEUE (COPY MODE)
+*
+* Description: This function copies a message into a queue created by OSQCreateCopy().  The caller's buffer can be
+*              reused as soon as this function returns.
+*
+* Arguments  : p_q           is a pointer to a message queue that must have been created by OSQCreateCopy().
+*
+*              p_void        is a pointer to the message to copy.
+*
+*              msg_size      specifies the number of bytes to copy (must not exceed the element size of the queue)
+*
+*              opt           determines the type of POST performed (same options as OSQPost()):
+*
+*                                OS_OPT_POST_FIFO         POST message to end of queue (FIFO)
+*                                OS_OPT_POST_LIFO         POST message to the front of the queue (LIFO)
+*                                OS_OPT_POST_ALL          POST to ALL tasks that are waiting on the queue
+*                                OS_OPT_POST_NO_SCHED     Do not call the scheduler
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE            The call was successful and the message was sent
+*                                OS_ERR_MSG_POOL_EMPTY  If the queue is full
+*                                OS_ERR_OBJ_PTR_NULL    If 'p_q' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE        If the message queue was not created by OSQCreateCopy()
+*                                OS_ERR_OS_NOT_RUNNING  If uC/OS-III is not running yet
+*                                OS_ERR_POST_ISR        If called from an ISR while OS_CFG_ISR_POST_DEFERRED_EN is set
+*                                OS_ERR_PTR_INVALID     If 'p_void' is a NULL pointer
+*                              + OS_ERR_OPT_INVALID     You specified an invalid option
+*                              + OS_ERR_Q_MSG_SIZE      If 'msg_size' is 0 or exceeds the element size of the queue
+*                            -------------说明-------------
+*                                OS_ERR_XXXX        表示可以继续沿用uCOS-III原版的错误码
+*                              - OS_ERR_XXXX        表示该错误码在本兼容层已经无法使用
+*                              + OS_ERR_RT_XXXX     表示该错误码为新增的RTT专用错误码集
+*                              应用层需要对API返回的错误码判断做出相应的修改
+*
+* Returns    : None
+*
+* Note(s)    : 1) 该函数为兼容层新增函数,原版uCOS-III没有该函数.未使能OS_CFG_ISR_POST_DEFERRED_EN时可以在中断中调用
+*
+*              2) 中断队列只能保存消息指针,无法在中断返回后再拷贝调用者的消息内容,因此使能OS_CFG_ISR_POST_DEFERRED_EN时
+*                 不允许在中断中调用本函数,以免在关中断期间广播或越过此前被延迟的发布
+************************************************************************************************************************
+*/
+
+#if OS_CFG_Q_COPY_EN > 0u
+void  OSQPostCopy (OS_Q         *p_q,
+                   void         *p_void,
+                   OS_MSG_SIZE   msg_size,
+                   OS_OPT        opt,
+                   OS_ERR       *p_err)
+{
+    rt_err_t rt_err;
+#if OS_CFG_DBG_EN > 0u && !defined PKG_USING_UCOSIII_WRAPPER_TINY
+    rt_thread_t thread;
+#endif
+
+    CPU_SR_ALLOC();
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if OS_CFG_ISR_POST_DEFERRED_EN > 0u
+    if (OSIntNestingCtr > (OS_NESTING_CTR)0) {              /* 中断中的拷贝发布无法延迟 (see Note #2)                 */
+       *p_err = OS_ERR_POST_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                 /* Is the kernel running?                                 */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return;
+    }
+#endif
+
+#if OS_CFG_ARG_CHK_EN > 0u
+    if(p_q == RT_NULL)                                      /* 检查消息队列指针是否为NULL                             */
+    {
+        *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    if(p_void == RT_NULL)                                   /* 检查消息指针是否为NULL                                 */
+    {
+        *p_err = OS_ERR_PTR_INVALID;
+        return;
+    }
+    switch (opt) {
+        case OS_OPT_POST_FIFO:
+        case OS_OPT_POST_LIFO:
+        case OS_OPT_POST_FIFO | OS_OPT_POST_ALL:
+        case OS_OPT_POST_LIFO | OS_OPT_POST_ALL:
+        case OS_OPT_POST_FIFO | OS_OPT_POST_NO_SCHED:
+        case OS_OPT_POST_LIFO | OS_OPT_POST_NO_SCHED:
+        case OS_OPT_POST_FIFO | OS_OPT_POST_ALL | OS_OPT_POST_NO_SCHED:
+        case OS_OPT_POST_LIFO | OS_OPT_POST_ALL | OS_OPT_POST_NO_SCHED:
+             break;
+
+        default:
+            *p_err =  OS_ERR_OPT_INVALID;
+             return;
+    }
+#endif
+
+#if OS_CFG_OBJ_TYPE_CHK_EN > 0u
+    /*判断内核对象是否为消息队列*/
+    if(rt_object_get_type(&p_q->Msg.parent.parent) != RT_Object_Class_MessageQueue)
+    {
+        *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    if(p_q->MsgSize == 0u)                                  /* 传递指针模式的消息队列不能拷贝收发,始终检查            */
+    {
+        *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+
+    if(msg_size == 0u || msg_size > p_q->MsgSize)           /* 消息长度不能超过元素长度                               */
+    {
+        *p_err = OS_ERR_Q_MSG_SIZE;
+        return;
+    }
+
+    OS_TRACE(OS_TRACE_EV_Q_POST, p_q, msg_size);
+
+#if OS_CFG_TS_EN > 0u
+    p_q->TS = OS_PostTS();                                  /* 先记录时间戳,被唤醒的任务可能立即运行                  */
+#endif
+    /*消息内容由RTT直接拷贝到消息队列的存储区*/
+    if((opt & OS_OPT_POST_ALL) != 0u)
+    {
+        rt_err = rt_mq_send_all(&p_q->Msg, p_void, msg_size); /* 广播不需要区分FIFO还是LIFO                           */
+    }
+    else if((opt & OS_OPT_POST_LIFO) == 0u)
+    {
+        rt_err = rt_mq_send(&p_q->Msg, p_void, msg_size);
+    }
+    else
+    {
+        rt_err = rt_mq_urgent(&p_q->Msg, p_void, msg_size);
+    }
+    if(rt_err == -RT_EFULL)
+    {
+        *p_err = OS_ERR_MSG_POOL_EMPTY;
+    }
+    else
+    {
+        *p_err = rt_err_to_ucosiii(rt_err);
+    }
+
+    CPU_CRITICAL_ENTER();
+#if OS_CFG_OBJ_STAT_EN > 0u
+    if(p_q->MsgQtyMax < (OS_MSG_QTY)p_q->Msg.entry)         /* 记录队列中消息数的峰值                                 */
+    {
+        p_q->MsgQtyMax = (OS_MSG_QTY)p_q->Msg.entry;
+    }
+#endif
+#if OS_CFG_DBG_EN > 0u && !defined PKG_USING_UCOSIII_WRAPPER_TINY
+    if(!rt_list_isempty(&(p_q->Msg.parent.suspend_thread)))
+    {
+        /*若等待表不为空，则将当前等待消息队列的线程赋值给.DbgNamePtr*/
+        thread = rt_list_entry((&(p_q->Msg.parent.suspend_thread))->next, struct rt_thread, tlist);
+        p_q->DbgNamePtr = thread->name;
+    }
+    else
+    {
+        p_q->DbgNamePtr = (CPU_CHAR *)((void *)" ");        /* 若为空,则清空当前.DbgNamePtr                           */
+    }
+#endif
+    CPU_CRITICAL_EXIT();
+}
+#endif
+
+/*
+************************************************************************************************************************
+*                                        CLEAR THE CONTENTS OF A MESSAGE QUEUE
+*
+* Description: This function is called by OSQDel() to clear the contents of a message queue
+*
+
+* Argument(s): p_q      is a pointer to the queue to clear
+*              ---
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+void  OS_QClr (OS_Q  *p_q)
+{
+#ifndef PKG_USING_UCOSIII_WRAPPER_TINY
+    p_q->Type    =  OS_OBJ_TYPE_NONE;                       /* Mark the data structure as a NONE                      */
+#endif
+#if OS_CFG_DBG_EN > 0u && !defined PKG_USING_UCOSIII_WRAPPER_TINY
     p_q->NamePtr = (CPU_CHAR *)((void *)"?Q");
 #endif
 }
 
+/*
+************************************************************************************************************************
+*                                        INSERT A MESSAGE ACCORDING TO ITS PRIORITY
+*
+* Description: This function inserts a message into the RTT message queue so that the list stays sorted by message
+*              priority (FIFO within the same priority) and readies the first task waiting on the queue.
+*
+* Argument(s): p_q      is a pointer to the message queue
+*              ---
+*
+*              p_msg    is a pointer to the uCOS message segment to copy into the queue
+*
+*              prio     is the priority of the message (0 is the highest)
+*
+*              opt      OS_OPT_POST_LIFO inserts the message at the head of the queue regardless of 'prio'
+*
+* Returns    : RT_EOK       the message was inserted
+*              -RT_EFULL    the queue is full
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) 消息只会从队头被取走(rt_mq_recv)或被整体清空(OSQFlush),而链表按优先级有序,因此被取走的消息必然依次
+*                 属于优先级最高的非空桶.插入前比较上次记录的消息总数与RTT当前的消息数,即可把被取走的消息从各优先级桶
+*                 中扣除,不需要修改RTT的接收流程
+************************************************************************************************************************
+*/
+
+#if OS_CFG_Q_PRIO_EN > 0u
+rt_err_t  OS_QPrioPost (OS_Q        *p_q,
+                        ucos_msg_t  *p_msg,
+                        OS_PRIO      prio,
+                        OS_OPT       opt)
+{
+    struct rt_messagequeue  *mq;
+    struct _rt_mq_message   *msg;
+    struct _rt_mq_message   *prev;
+    struct rt_thread        *thread;
+    OS_MSG_QTY               removed;
+    OS_PRIO                  i;
+
+    CPU_SR_ALLOC();
+
+    mq = &p_q->Msg;
+
+    CPU_CRITICAL_ENTER();
+    msg = (struct _rt_mq_message *)mq->msg_queue_free;      /* 从空闲链表取一个消息块                                 */
+    if(msg == RT_NULL)
+    {
+        CPU_CRITICAL_EXIT();
+        return -RT_EFULL;
+    }
+    mq->msg_queue_free = msg->next;
+    CPU_CRITICAL_EXIT();
+
+    rt_memcpy(msg + 1, p_msg, sizeof(ucos_msg_t));          /* 拷贝uCOS消息段                                         */
+
+    CPU_CRITICAL_ENTER();
+    removed = p_q->PrioEntries - mq->entry;                 /* 扣除上次插入以来已被取走的消息                         */
+    for(i = 0u; removed > 0u && i < (OS_PRIO)OS_CFG_Q_PRIO_LEVELS; i++)
+    {
+        if(p_q->PrioCtr[i] > removed)
+        {
+            p_q->PrioCtr[i] -= removed;
+            removed = 0u;
+        }
+        else
+        {
+            removed -= p_q->PrioCtr[i];
+            p_q->PrioCtr[i]     = 0u;
+            p_q->PrioTailPtr[i] = RT_NULL;
+        }
+    }
+
+    if((opt & OS_OPT_POST_LIFO) != 0u)                      /* LIFO:插到队头,归入最高优先级桶                         */
+    {
+        prio = 0u;
+        prev = RT_NULL;
+        if(p_q->PrioCtr[0] == 0u)
+        {
+            p_q->PrioTailPtr[0] = msg;
+        }
+    }
+    else                                                    /* 插到不低于本优先级的最近非空桶之后                     */
+    {
+        prev = RT_NULL;
+        i    = prio + 1u;
+        while(i > 0u)
+        {
+            i--;
+            if(p_q->PrioCtr[i] > 0u)
+            {
+                prev = (struct _rt_mq_message *)p_q->PrioTailPtr[i];
+                break;
+            }
+        }
+        p_q->PrioTailPtr[prio] = msg;
+    }
+    p_q->PrioCtr[prio]++;
+
+    if(prev == RT_NULL)                                     /* 链接到RTT消息链表                                      */
+    {
+        msg->next = (struct _rt_mq_message *)mq->msg_queue_head;
+        mq->msg_queue_head = msg;
+    }
+    else
+    {
+        msg->next  = prev->next;
+        prev->next = msg;
+    }
+    if(msg->next == RT_NULL)
+    {
+        mq->msg_queue_tail = msg;
+    }
+    mq->entry++;
+    p_q->PrioEntries = mq->entry;
+
+    if(!rt_list_isempty(&mq->parent.suspend_thread))        /* 唤醒第一个等待该消息队列的任务                         */
+    {
+        thread = rt_list_entry(mq->parent.suspend_thread.next, struct rt_thread, tlist);
+        rt_thread_resume(thread);
+        CPU_CRITICAL_EXIT();
+
+        if((opt & OS_OPT_POST_NO_SCHED) == (OS_OPT)0)
+        {
+            rt_schedule();
+        }
+        return RT_EOK;
+    }
+    CPU_CRITICAL_EXIT();
+
+    return RT_EOK;
+}
+#endif
+
 /*
 ************************************************************************************************************************
 *                                      ADD/REMOVE MESSAGE QUEUE TO/FROM DEBUG LIST
@@ -93,6 +93,41 @@ rt_err_t rt_ipc_pend_abort_1 (rt_list_t *list)
     return RT_EOK;
 }
 
+/**
+ * 将线程按优先级插入挂起表(由rt_ipc_list_suspend函数改编),线程必须已经被挂起,且不在其他链表上
+ * 必须在关中断时调用
+ *
+ * @param 挂起表表头指针
+ *
+ * @param 要插入的线程
+ */
+void rt_ipc_list_insert_prio (rt_list_t *list, struct rt_thread *thread)
+{
+    struct rt_list_node *n;
+    struct rt_thread *sthread;
+
+    /* find a suitable position */
+    for (n = list->next; n != list; n = n->next)
+    {
+        sthread = rt_list_entry(n, struct rt_thread, tlist);
+
+        /* find out */
+        if (thread->current_priority < sthread->current_priority)
+        {
+            /* insert this thread before the sthread */
+            rt_list_insert_before(&(sthread->tlist), &(thread->tlist));
+            break;
+        }
+    }
+
+    /*
+     * not found a suitable position,
+     * append to the end of suspend_thread list
+     */
+    if (n == list)
+        rt_list_insert_before(list, &(thread->tlist));
+}
+
 /**
  * 让所有等待该IPC的任务全部放弃等待，进入就绪态(由rt_ipc_list_resume_all函数改编)
  *
@@ -323,6 +358,24 @@ rt_err_t rt_mq_send_all(rt_mq_t mq, void *buffer, rt_size_t size)
  * msh命令：uCOS-III兼容层信息获取
  */
 #if defined RT_USING_FINSH && OS_CFG_DBG_EN > 0u
+#if OS_CFG_OBJ_STAT_EN > 0u
+static void rt_ucosiii_obj_stat_show (const char *type, const char *name, OS_OBJ_STAT *p_stat)
+{
+    OS_OBJ_STAT stat;
+
+    CPU_SR_ALLOC();
+
+    CPU_CRITICAL_ENTER();
+    stat = *p_stat;                                         /* 取快照,避免打印过程中被修改                            */
+    CPU_CRITICAL_EXIT();
+    rt_kprintf("%-5s %-*.*s %-10u %-10u %-10u %-10u %-10u %-10u %u/%u\n",
+               type, RT_NAME_MAX, RT_NAME_MAX, name,
+               stat.PendCtr, stat.PendBlockCtr, stat.PendTimeoutCtr, stat.PendAbortCtr,
+               stat.PendBlockTicksTotal, stat.PendBlockTicksMax,
+               stat.PendWaiters, stat.PendWaitersMax);
+}
+#endif
+
 static void rt_ucosiii_wrapper_info (int argc, char *argv[])
 {
 #if OS_CFG_STAT_TASK_EN > 0u
@@ -337,6 +390,16 @@ static void rt_ucosiii_wrapper_info (int argc, char *argv[])
 #endif
 #if OS_CFG_MUTEX_EN > 0u
     OS_MUTEX *p_mutex;
+#if OS_CFG_MUTEX_PROFILE_EN > 0u
+    OS_CTR mutex_hold_ctr;
+    CPU_TS mutex_hold_avg;
+#endif
+#endif
+#if OS_CFG_COND_EN > 0u
+    OS_COND *p_cond;
+#endif
+#if OS_CFG_RWLOCK_EN > 0u
+    OS_RWLOCK *p_rwlock;
 #endif
 #if OS_CFG_Q_EN > 0u
     OS_Q *p_q;
@@ -344,6 +407,27 @@ static void rt_ucosiii_wrapper_info (int argc, char *argv[])
 #if OS_CFG_FLAG_EN > 0u
     OS_FLAG_GRP *p_flag;
 #endif
+#if OS_CFG_TRACE_EN > 0u
+    OS_TRACE_REC *p_rec;
+    CPU_BOOLEAN trace_en;
+    CPU_INT32U trace_ix;
+    CPU_INT32U trace_nbr;
+    CPU_INT32U trace_freq;
+#if (CPU_CFG_TS_TMR_EN == DEF_ENABLED)
+    CPU_ERR cpu_err;
+#endif
+#endif
+#if OS_CFG_SCHED_LOCK_TIME_MEAS_EN > 0u
+    CPU_TS sched_lock_max;
+    CPU_TS sched_lock_max_cur;
+    CPU_CHAR sched_lock_name[RT_NAME_MAX];
+#endif
+#ifdef CPU_CFG_INT_DIS_MEAS_EN
+    const CPU_CHAR *int_dis_file;
+    CPU_INT32U int_dis_line;
+    CPU_INT32U int_dis_hist[CPU_CFG_INT_DIS_MEAS_HIST_SIZE];
+    CPU_INT16U i;
+#endif
 
     CPU_SR_ALLOC();
 
@@ -366,6 +450,12 @@ static void rt_ucosiii_wrapper_info (int argc, char *argv[])
 #if OS_CFG_MUTEX_EN > 0u
         rt_kprintf("-m mutex\n");
 #endif
+#if OS_CFG_COND_EN > 0u
+        rt_kprintf("-c condition variable\n");
+#endif
+#if OS_CFG_RWLOCK_EN > 0u
+        rt_kprintf("-rw reader-writer lock\n");
+#endif
 #if OS_CFG_Q_EN > 0u
         rt_kprintf("-q message queue\n");
 #endif
@@ -374,6 +464,18 @@ static void rt_ucosiii_wrapper_info (int argc, char *argv[])
 #endif
 #if OS_CFG_TMR_EN > 0u
         rt_kprintf("-r timer\n");
+#endif
+#ifdef CPU_CFG_INT_DIS_MEAS_EN
+        rt_kprintf("-i interrupt disabled time\n");
+#endif
+#if OS_CFG_SCHED_LOCK_TIME_MEAS_EN > 0u
+        rt_kprintf("-l scheduler lock time\n");
+#endif
+#if OS_CFG_TRACE_EN > 0u
+        rt_kprintf("-trace [on|off|clr] dump/control the trace recorder\n");
+#endif
+#if OS_CFG_OBJ_STAT_EN > 0u
+        rt_kprintf("-stat kernel object contention statistics\n");
 #endif
     }
     else if(!strcmp((const char *)argv[1],(const char *)"-v"))
@@ -399,9 +501,165 @@ static void rt_ucosiii_wrapper_info (int argc, char *argv[])
         rt_kprintf("-----------------uCOS-III Timer--------------------\n");
         while(p_tmr)
         {
+#if OS_CFG_TMR_SLACK_EN > 0u
+            rt_kprintf("name:%-*.*s slack:%u\n",
+                       RT_NAME_MAX, RT_NAME_MAX, p_tmr->Tmr.parent.name, p_tmr->Slack);
+#else
             rt_kprintf("name:%s\n",p_tmr->Tmr.parent.name);
+#endif
             p_tmr = p_tmr->DbgNextPtr;
         }
+        rt_kprintf("expirations:%u wakeups:%u\n", OSTmrExpireCtr, OSTmrWakeupCtr);
+        rt_kprintf("\n");
+    }
+#endif
+#if OS_CFG_TRACE_EN > 0u
+    else if(!strcmp((const char *)argv[1],(const char *)"-trace"))
+    {
+        if(argc > 2)
+        {
+            if(!strcmp((const char *)argv[2],(const char *)"on"))
+            {
+                OSTraceEnable(DEF_ENABLED);
+            }
+            else if(!strcmp((const char *)argv[2],(const char *)"off"))
+            {
+                OSTraceEnable(DEF_DISABLED);
+            }
+            else if(!strcmp((const char *)argv[2],(const char *)"clr"))
+            {
+                OSTraceClr();
+            }
+            else
+            {
+                rt_kprintf("invalid parameter,use --help to get more information.\n");
+            }
+            return;
+        }
+        /* 导出期间暂停记录,输出格式由tools/os_trace2json.py解析 */
+        trace_en = OSTraceEn;
+        OSTraceEnable(DEF_DISABLED);
+#if (CPU_CFG_TS_TMR_EN == DEF_ENABLED)
+        trace_freq = (CPU_INT32U)CPU_TS_TmrFreqGet(&cpu_err);
+#else
+        trace_freq = (CPU_INT32U)RT_TICK_PER_SECOND;
+#endif
+        if(OSTraceCtr < OS_CFG_TRACE_BUF_SIZE)              /* 缓冲区尚未写满,从头开始导出 */
+        {
+            trace_ix  = 0u;
+            trace_nbr = OSTraceCtr;
+        }
+        else                                                /* 缓冲区已经回绕,从最旧的记录开始导出 */
+        {
+            trace_ix  = OSTraceIx;
+            trace_nbr = OS_CFG_TRACE_BUF_SIZE;
+        }
+        rt_kprintf("OSTRACE 1 %u %u %u\n", OS_CFG_TRACE_BUF_SIZE, OSTraceCtr, trace_freq);
+        while(trace_nbr > 0u)
+        {
+            p_rec = &OSCfg_TraceBuf[trace_ix];
+            rt_kprintf("R %08x %u %u %08x %08x %08x\n",
+                       p_rec->TS, p_rec->Event, p_rec->IntNest, p_rec->Task, p_rec->Obj, p_rec->Arg);
+            trace_ix++;
+            if(trace_ix >= OS_CFG_TRACE_BUF_SIZE)
+            {
+                trace_ix = 0u;
+            }
+            trace_nbr--;
+        }
+        rt_kprintf("OSTRACE END\n");
+        OSTraceEnable(trace_en);
+    }
+#endif
+#if OS_CFG_SCHED_LOCK_TIME_MEAS_EN > 0u
+    else if(!strcmp((const char *)argv[1],(const char *)"-l"))
+    {
+        CPU_CRITICAL_ENTER();
+        sched_lock_max     = OSSchedLockTimeMax;
+        sched_lock_max_cur = OSSchedLockTimeMaxCur;
+        rt_strncpy(sched_lock_name, OSSchedLockTimeMaxName, RT_NAME_MAX);
+        CPU_CRITICAL_EXIT();
+        rt_kprintf("-----------------Scheduler Lock Time---------------\n");
+        rt_kprintf("max:%u cur:%u owner:%.*s\n", sched_lock_max, sched_lock_max_cur,
+                   RT_NAME_MAX, sched_lock_name);
+        rt_kprintf("\n");
+    }
+#endif
+#ifdef CPU_CFG_INT_DIS_MEAS_EN
+    else if(!strcmp((const char *)argv[1],(const char *)"-i"))
+    {
+        CPU_IntDisMeasMaxSiteGet(&int_dis_file, &int_dis_line);
+        CPU_IntDisMeasHistGet(int_dis_hist, CPU_CFG_INT_DIS_MEAS_HIST_SIZE);
+        rt_kprintf("-----------------Interrupt Disabled Time-----------\n");
+        rt_kprintf("max:%u cnts at %s:%u\n", CPU_IntDisMeasMaxGet(),
+                   (int_dis_file != (const CPU_CHAR *)0) ? int_dis_file : "-", int_dis_line);
+        for(i = 0u; i < CPU_CFG_INT_DIS_MEAS_HIST_SIZE; i++)
+        {
+            if(int_dis_hist[i] != 0u)
+            {
+                rt_kprintf(">=%-10u cnts: %u\n", (rt_uint32_t)1u << i, int_dis_hist[i]);
+            }
+        }
+        CPU_CRITICAL_ENTER();
+        p_tcb = OSTaskDbgListPtr;
+        CPU_CRITICAL_EXIT();
+        while(p_tcb)
+        {
+            rt_kprintf("name:%-*.*s max:%u cnts\n",
+                       RT_NAME_MAX, RT_NAME_MAX, p_tcb->Task.name, p_tcb->IntDisTimeMax);
+            p_tcb = p_tcb->DbgNextPtr;
+        }
+        rt_kprintf("\n");
+    }
+#endif
+#if OS_CFG_OBJ_STAT_EN > 0u
+    else if(!strcmp((const char *)argv[1],(const char *)"-stat"))
+    {
+        rt_kprintf("-----------------Kernel Object Contention----------\n");
+        rt_kprintf("type  %-*s pend       block      timeout    abort      ticks      ticks-max  waiters/max\n",
+                   RT_NAME_MAX, "name");
+#if OS_CFG_SEM_EN > 0u
+        CPU_CRITICAL_ENTER();
+        p_sem = OSSemDbgListPtr;
+        CPU_CRITICAL_EXIT();
+        while(p_sem)
+        {
+            rt_ucosiii_obj_stat_show("sem", p_sem->Sem.parent.parent.name, &p_sem->Stat);
+            p_sem = p_sem->DbgNextPtr;
+        }
+#endif
+#if OS_CFG_MUTEX_EN > 0u
+        CPU_CRITICAL_ENTER();
+        p_mutex = OSMutexDbgListPtr;
+        CPU_CRITICAL_EXIT();
+        while(p_mutex)
+        {
+            rt_ucosiii_obj_stat_show("mutex", p_mutex->Mutex.parent.parent.name, &p_mutex->Stat);
+            p_mutex = p_mutex->DbgNextPtr;
+        }
+#endif
+#if OS_CFG_Q_EN > 0u
+        CPU_CRITICAL_ENTER();
+        p_q = OSQDbgListPtr;
+        CPU_CRITICAL_EXIT();
+        while(p_q)
+        {
+            rt_ucosiii_obj_stat_show("q", p_q->Msg.parent.parent.name, &p_q->Stat);
+            rt_kprintf("      %-*s entries:%u peak:%u max:%u\n", RT_NAME_MAX, "",
+                       p_q->Msg.entry, p_q->MsgQtyMax, p_q->Msg.max_msgs);
+            p_q = p_q->DbgNextPtr;
+        }
+#endif
+#if OS_CFG_FLAG_EN > 0u
+        CPU_CRITICAL_ENTER();
+        p_flag = OSFlagDbgListPtr;
+        CPU_CRITICAL_EXIT();
+        while(p_flag)
+        {
+            rt_ucosiii_obj_stat_show("flag", p_flag->FlagGrp.parent.parent.name, &p_flag->Stat);
+            p_flag = p_flag->DbgNextPtr;
+        }
+#endif
         rt_kprintf("\n");
     }
 #endif
@@ -413,7 +671,14 @@ static void rt_ucosiii_wrapper_info (int argc, char *argv[])
         rt_kprintf("-----------------uCOS-III Task---------------------\n");
         while(p_tcb)
         {
+#if OS_CFG_TASK_PROFILE_EN > 0u
+            rt_kprintf("name:%-*.*s ctxsw:%-10u cpu:%d.%02d%% max:%d.%02d%%\n",
+                       RT_NAME_MAX, RT_NAME_MAX, p_tcb->Task.name, p_tcb->CtxSwCtr,
+                       p_tcb->CPUUsage/100, p_tcb->CPUUsage%100,
+                       p_tcb->CPUUsageMax/100, p_tcb->CPUUsageMax%100);
+#else
             rt_kprintf("name:%s\n",p_tcb->Task.name);
+#endif
             p_tcb = p_tcb->DbgNextPtr;
         }
         rt_kprintf("\n");
@@ -442,9 +707,77 @@ static void rt_ucosiii_wrapper_info (int argc, char *argv[])
         rt_kprintf("-----------------uCOS-III Mutex--------------------\n");
         while(p_mutex)
         {
+#if OS_CFG_MUTEX_PROFILE_EN > 0u
+            CPU_CRITICAL_ENTER();
+            mutex_hold_ctr = p_mutex->HoldCtr;
+            mutex_hold_avg = (mutex_hold_ctr > 0u) ? (CPU_TS)(p_mutex->HoldTimeTotal / mutex_hold_ctr) : 0u;
+            CPU_CRITICAL_EXIT();
+            rt_kprintf("name:%-*.*s owner:%-*.*s holds:%-10u max:%-10u avg:%-10u boosts:%u\n",
+                       RT_NAME_MAX, RT_NAME_MAX, p_mutex->Mutex.parent.parent.name,
+                       RT_NAME_MAX, RT_NAME_MAX,
+                       (p_mutex->Mutex.owner != RT_NULL) ? p_mutex->Mutex.owner->name : "-",
+                       mutex_hold_ctr, p_mutex->HoldTimeMax, mutex_hold_avg, p_mutex->BoostCtr);
+#else
             rt_kprintf("name:%s\n",p_mutex->Mutex.parent.parent.name);
+#endif
             p_mutex = p_mutex->DbgNextPtr;
         }
+#if OS_CFG_MUTEX_PROFILE_EN > 0u
+        rt_kprintf("-----------------Held By Task----------------------\n");
+        CPU_CRITICAL_ENTER();
+        p_tcb = OSTaskDbgListPtr;
+        CPU_CRITICAL_EXIT();
+        while(p_tcb)
+        {
+            rt_enter_critical();                            /* 持有链表只在任务级修改,锁调度器即可                    */
+            p_mutex = p_tcb->MutexHeldPtr;
+            while(p_mutex)                                  /* 打印持有中的互斥量及已持有的时间                       */
+            {
+                rt_kprintf("task:%-*.*s mutex:%-*.*s held:%u\n",
+                           RT_NAME_MAX, RT_NAME_MAX, p_tcb->Task.name,
+                           RT_NAME_MAX, RT_NAME_MAX, p_mutex->Mutex.parent.parent.name,
+                           OS_TS_GET() - p_mutex->HeldTS);
+                p_mutex = p_mutex->HeldNextPtr;
+            }
+            rt_exit_critical();
+            p_tcb = p_tcb->DbgNextPtr;
+        }
+#endif
+        rt_kprintf("\n");
+    }
+#endif
+#if OS_CFG_COND_EN > 0u
+    else if(!strcmp((const char *)argv[1],(const char *)"-c"))
+    {
+        CPU_CRITICAL_ENTER();
+        p_cond = OSCondDbgListPtr;
+        CPU_CRITICAL_EXIT();
+        rt_kprintf("-----------------uCOS-III Cond---------------------\n");
+        while(p_cond)
+        {
+            rt_kprintf("name:%-*.*s waiting:%s\n",
+                       RT_NAME_MAX, RT_NAME_MAX, p_cond->NamePtr, p_cond->DbgNamePtr);
+            p_cond = p_cond->DbgNextPtr;
+        }
+        rt_kprintf("\n");
+    }
+#endif
+#if OS_CFG_RWLOCK_EN > 0u
+    else if(!strcmp((const char *)argv[1],(const char *)"-rw"))
+    {
+        CPU_CRITICAL_ENTER();
+        p_rwlock = OSRWLockDbgListPtr;
+        CPU_CRITICAL_EXIT();
+        rt_kprintf("-----------------uCOS-III RWLock-------------------\n");
+        while(p_rwlock)
+        {
+            rt_kprintf("name:%-*.*s writer:%-*.*s readers:%-5u waiting:%s\n",
+                       RT_NAME_MAX, RT_NAME_MAX, p_rwlock->NamePtr,
+                       RT_NAME_MAX, RT_NAME_MAX,
+                       (p_rwlock->WriterTCBPtr != (OS_TCB *)0) ? p_rwlock->WriterTCBPtr->Task.name : "-",
+                       p_rwlock->ReaderCtr, p_rwlock->DbgNamePtr);
+            p_rwlock = p_rwlock->DbgNextPtr;
+        }
         rt_kprintf("\n");
     }
 #endif
@@ -0,0 +1,1262 @@
+/*
+ * Copyright (c) 2021, Meco Jianting Man <jiantingman@foxmail.com>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2026-10-19     agent        implement reader-writer locks
+ */
+/*
+************************************************************************************************************************
+*                                                      uC/OS-III
+*                                                 The Real-Time Kernel
+*
+*                                              READER-WRITER LOCK MANAGEMENT
+*
+* File    : OS_RWLOCK.C
+* Version : V3.03.00
+************************************************************************************************************************
+* Note(s)    : 1) 读写锁允许多个任务同时持有读锁,或者一个任务独占写锁.RT-Thread没有读写锁对象,因此读写锁由兼容层
+*                 自己实现:等待读锁和等待写锁的任务分别挂在两个按优先级排列的等待链表上,阻塞与超时使用线程自带的
+*                 定时器(参见OSTaskNotifyWait()).
+*
+*              2) 写者优先:只要有任务持有或等待写锁,新的读者就必须等待.写锁被释放时,若有任务等待写锁,则写锁直接
+*                 交给优先级最高的写者;否则所有等待读锁的任务同时获得读锁.最后一个读者释放读锁时,写锁直接交给
+*                 优先级最高的写者.被唤醒的任务返回时已经持有锁,不需要再次竞争.
+*
+*              3) 没有写者时OSRWLockReadPend()/OSRWLockReadPost()只在一个很短的临界区内修改读者计数,不访问等待
+*                 链表,也不调用调度器.
+*
+*              4) 读写锁不支持优先级继承,也不支持嵌套:持有写锁的任务不能再次获得读锁或写锁,持有读锁的任务
+*                 不能再获得写锁(兼容层无法检测这种情况,将导致死锁).
+*
+*              5) 读写锁只记录读者的数量而不记录读者是谁,OSRWLockReadPost()无法检查调用者是否真的持有读锁.
+************************************************************************************************************************
+*/
+
+#include "os.h"
+
+#if OS_CFG_RWLOCK_EN > 0u
+static  void        OS_RWLockBlock     (OS_RWLOCK  *p_rwlock,
+                                        rt_list_t  *p_list,
+                                        OS_TCB     *p_tcb,
+                                        OS_TICK     timeout);
+
+static  OS_OBJ_QTY  OS_RWLockGrant     (OS_RWLOCK  *p_rwlock);
+
+#if OS_CFG_DBG_EN > 0u && !defined PKG_USING_UCOSIII_WRAPPER_TINY
+static  void        OS_RWLockDbgNameUpd(OS_RWLOCK  *p_rwlock);
+#endif
+
+/*
+************************************************************************************************************************
+*                                              CREATE A READER-WRITER LOCK
+*
+* Description: This function creates a reader-writer lock.
+*
+* Arguments  : p_rwlock      is a pointer to the reader-writer lock to initialize.  Your application is responsible for
+*                            allocating storage for the lock.
+*
+*              p_name        is a pointer to the name you would like to give the reader-writer lock.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE                    if the call was successful
+*                                OS_ERR_CREATE_ISR              if you called this function from an ISR
+*                                OS_ERR_ILLEGAL_CREATE_RUN_TIME if you are trying to create the lock after you called
+*                                                                 OSSafetyCriticalStart().
+*                                OS_ERR_NAME                    if 'p_name'   is a NULL pointer
+*                                OS_ERR_OBJ_CREATED             if the reader-writer lock has already been created
+*                                OS_ERR_OBJ_PTR_NULL            if 'p_rwlock' is a NULL pointer
+*
+* Returns    : none
+*
+* Note(s)    : 1) 该函数为兼容层新增函数,原版uCOS-III没有读写锁
+************************************************************************************************************************
+*/
+
+void  OSRWLockCreate (OS_RWLOCK  *p_rwlock,
+                      CPU_CHAR   *p_name,
+                      OS_ERR     *p_err)
+{
+    CPU_SR_ALLOC();
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == DEF_TRUE) {
+       *p_err = OS_ERR_ILLEGAL_CREATE_RUN_TIME;
+        return;
+    }
+#endif
+
+#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u
+    if(OSIntNestingCtr > (OS_NESTING_CTR)0)                 /* 检查是否在中断中运行                                   */
+    {
+        *p_err = OS_ERR_CREATE_ISR;
+        return;
+    }
+#endif
+
+#if OS_CFG_ARG_CHK_EN > 0u
+    if(p_rwlock == RT_NULL)                                 /* 检查读写锁指针是否为NULL                               */
+    {
+        *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    if(p_name == RT_NULL)                                   /* 检查读写锁名称指针是否为NULL                           */
+    {
+        *p_err = OS_ERR_NAME;
+        return;
+    }
+#endif
+
+#if OS_CFG_OBJ_TYPE_CHK_EN > 0u
+    if(p_rwlock->Type == OS_OBJ_TYPE_RWLOCK)                /* 判断是否已经创建过                                     */
+    {
+        *p_err = OS_ERR_OBJ_CREATED;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    rt_list_init(&p_rwlock->ReadWaitList);
+    rt_list_init(&p_rwlock->WriteWaitList);
+    p_rwlock->Type         =  OS_OBJ_TYPE_RWLOCK;
+    p_rwlock->ReaderCtr    = (OS_OBJ_QTY)0;                 /* Lock is available                                      */
+    p_rwlock->WriterTCBPtr = (OS_TCB   *)0;
+#if OS_CFG_TS_EN > 0u
+    p_rwlock->TS           = (CPU_TS    )0;
+#endif
+#ifndef PKG_USING_UCOSIII_WRAPPER_TINY
+#if OS_CFG_DBG_EN > 0u
+    p_rwlock->NamePtr      =  p_name;
+    OS_RWLockDbgListAdd(p_rwlock);
+#endif
+    OSRWLockQty++;
+#endif
+    CPU_CRITICAL_EXIT();
+
+#if OS_CFG_DBG_EN == 0u || defined PKG_USING_UCOSIII_WRAPPER_TINY
+    (void)p_name;
+#endif
+   *p_err = OS_ERR_NONE;
+}
+
+/*
+************************************************************************************************************************
+*                                              DELETE A READER-WRITER LOCK
+*
+* Description: This function deletes a reader-writer lock and readies all tasks pending on it.
+*
+* Arguments  : p_rwlock      is a pointer to the reader-writer lock to delete
+*
+*              opt           determines delete options as follows:
+*
+*                                OS_OPT_DEL_NO_PEND          Delete the lock ONLY if no task pending
+*                                OS_OPT_DEL_ALWAYS           Deletes the lock even if tasks are waiting.
+*                                                            In this case, all the tasks pending will be readied.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE                 The call was successful and the lock was deleted
+*                                OS_ERR_DEL_ISR              If you attempted to delete the lock from an ISR
+*                                OS_ERR_ILLEGAL_DEL_RUN_TIME If you are trying to delete the lock after you called
+*                                                               OSSafetyCriticalStart()
+*                                OS_ERR_OBJ_PTR_NULL         If 'p_rwlock' is a NULL pointer.
+*                                OS_ERR_OBJ_TYPE             If 'p_rwlock' is not pointing to a reader-writer lock
+*                                OS_ERR_OPT_INVALID          An invalid option was specified
+*                                OS_ERR_OS_NOT_RUNNING       If uC/OS-III is not running yet
+*                                OS_ERR_TASK_WAITING         One or more tasks were waiting on the lock
+*
+* Returns    : == 0          if no tasks were waiting on the lock, or upon error.
+*              >  0          if one or more tasks waiting on the lock are now readied and informed.
+*
+* Note(s)    : 1) 被唤醒的任务将从OSRWLockReadPend()/OSRWLockWritePend()返回OS_ERR_RT_ERROR(与其他内核对象被删除时
+*                 一致,参见OSMutexDel()).
+************************************************************************************************************************
+*/
+
+#if OS_CFG_RWLOCK_DEL_EN > 0u
+OS_OBJ_QTY  OSRWLockDel (OS_RWLOCK  *p_rwlock,
+                         OS_OPT      opt,
+                         OS_ERR     *p_err)
+{
+    OS_OBJ_QTY   nbr_tasks;
+    rt_list_t   *p_list;
+    rt_thread_t  thread;
+
+    CPU_SR_ALLOC();
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return ((OS_OBJ_QTY)0);
+    }
+#endif
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+    if (OSSafetyCriticalStartFlag == OS_TRUE) {
+       *p_err = OS_ERR_ILLEGAL_DEL_RUN_TIME;
+        return (0u);
+    }
+#endif
+
+#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u
+    if(OSIntNestingCtr > (OS_NESTING_CTR)0)                 /* 检查是否在中断中运行                                   */
+    {
+        *p_err = OS_ERR_DEL_ISR;
+        return 0;
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                 /* Is the kernel running?                                 */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return (0u);
+    }
+#endif
+
+#if OS_CFG_ARG_CHK_EN > 0u
+    if(p_rwlock == RT_NULL)                                 /* 检查指针是否为空                                       */
+    {
+        *p_err = OS_ERR_OBJ_PTR_NULL;
+        return 0;
+    }
+    switch (opt) {
+        case OS_OPT_DEL_NO_PEND:
+        case OS_OPT_DEL_ALWAYS:
+             break;
+
+        default:
+            *p_err =  OS_ERR_OPT_INVALID;
+             return ((OS_OBJ_QTY)0);
+    }
+#endif
+
+#if OS_CFG_OBJ_TYPE_CHK_EN > 0u
+    if(p_rwlock->Type != OS_OBJ_TYPE_RWLOCK)                /* 判断内核对象是否为读写锁                               */
+    {
+        *p_err = OS_ERR_OBJ_TYPE;
+        return 0;
+    }
+#endif
+
+    nbr_tasks = (OS_OBJ_QTY)0;
+    CPU_CRITICAL_ENTER();
+    if((opt == OS_OPT_DEL_NO_PEND) &&
+       ((!rt_list_isempty(&p_rwlock->ReadWaitList)) || (!rt_list_isempty(&p_rwlock->WriteWaitList))))
+    {
+        CPU_CRITICAL_EXIT();
+        *p_err = OS_ERR_TASK_WAITING;
+        return 0;
+    }
+
+    p_list = &p_rwlock->WriteWaitList;                      /* 唤醒所有等待写锁和读锁的任务                           */
+    while(p_list != RT_NULL)
+    {
+        while(!rt_list_isempty(p_list))
+        {
+            thread = rt_list_entry(p_list->next, struct rt_thread, tlist);
+            thread->error = -RT_ERROR;
+            rt_thread_resume(thread);                       /* 将线程从等待链表中移除并就绪                           */
+            nbr_tasks++;
+        }
+        p_list = (p_list == &p_rwlock->WriteWaitList) ? &p_rwlock->ReadWaitList : RT_NULL;
+    }
+
+#ifndef PKG_USING_UCOSIII_WRAPPER_TINY
+#if OS_CFG_DBG_EN > 0u
+    OS_RWLockDbgListRemove(p_rwlock);
+#endif
+    OSRWLockQty--;
+#endif
+    OS_RWLockClr(p_rwlock);
+    CPU_CRITICAL_EXIT();
+
+    if(nbr_tasks > (OS_OBJ_QTY)0)
+    {
+        rt_schedule();
+    }
+
+    *p_err = OS_ERR_NONE;
+    return nbr_tasks;
+}
+#endif
+
+/*
+************************************************************************************************************************
+*                                          ABORT WAITING ON A READER-WRITER LOCK
+*
+* Description: This function aborts & readies any tasks currently waiting on a reader-writer lock.  This function should
+*              be used to fault-abort the wait on the lock, rather than to normally release it.
+*
+* Arguments  : p_rwlock  is a pointer to the reader-writer lock
+*
+*              opt       determines the type of ABORT performed:
+*
+*                            OS_OPT_PEND_ABORT_1          ABORT wait for a single task (HPT) waiting on the lock
+*                            OS_OPT_PEND_ABORT_ALL        ABORT wait for ALL tasks that are  waiting on the lock
+*                            OS_OPT_POST_NO_SCHED         Do not call the scheduler
+*
+*              p_err     is a pointer to a variable that will contain an error code returned by this function.
+*
+*                            OS_ERR_NONE                  At least one task waiting on the lock was readied and
+*                                                         informed of the aborted wait; check return value for the
+*                                                         number of tasks whose wait on the lock was aborted.
+*                            OS_ERR_OBJ_PTR_NULL          If 'p_rwlock' is a NULL pointer.
+*                            OS_ERR_OBJ_TYPE              If 'p_rwlock' is not pointing at a reader-writer lock
+*                            OS_ERR_OPT_INVALID           If you specified an invalid option
+*                            OS_ERR_OS_NOT_RUNNING        If uC/OS-III is not running yet
+*                            OS_ERR_PEND_ABORT_ISR        If you attempted to call this function from an ISR
+*                            OS_ERR_PEND_ABORT_NONE       No task were pending
+*
+* Returns    : == 0          if no tasks were waiting on the lock, or upon error.
+*              >  0          if one or more tasks waiting on the lock are now readied and informed.
+*
+* Note(s)    : 1) OS_OPT_PEND_ABORT_1在两个等待链表中选择优先级最高的任务,优先级相同时选择等待写锁的任务.
+*
+*              2) 等待写锁的任务被放弃后,原本因写者优先而等待的读者可能可以获得读锁,它们会一并被唤醒(不计入返回值).
+************************************************************************************************************************
+*/
+
+#if OS_CFG_RWLOCK_PEND_ABORT_EN > 0u
+OS_OBJ_QTY  OSRWLockPendAbort (OS_RWLOCK  *p_rwlock,
+                               OS_OPT      opt,
+                               OS_ERR     *p_err)
+{
+    OS_OBJ_QTY   abort_tasks;
+    rt_list_t   *p_list;
+    rt_thread_t  reader;
+    rt_thread_t  writer;
+
+    CPU_SR_ALLOC();
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return ((OS_OBJ_QTY)0u);
+    }
+#endif
+
+#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u
+    if (OSIntNestingCtr > (OS_NESTING_CTR)0u) {             /* Not allowed to Pend Abort from an ISR                  */
+       *p_err =  OS_ERR_PEND_ABORT_ISR;
+        return ((OS_OBJ_QTY)0u);
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                 /* Is the kernel running?                                 */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return (0u);
+    }
+#endif
+
+#if OS_CFG_ARG_CHK_EN > 0u
+    if (p_rwlock == (OS_RWLOCK *)0) {                       /* Validate 'p_rwlock'                                    */
+       *p_err =  OS_ERR_OBJ_PTR_NULL;
+        return ((OS_OBJ_QTY)0u);
+    }
+    switch (opt) {                                          /* Validate 'opt'                                         */
+        case OS_OPT_PEND_ABORT_1:
+        case OS_OPT_PEND_ABORT_ALL:
+        case OS_OPT_PEND_ABORT_1   | OS_OPT_POST_NO_SCHED:
+        case OS_OPT_PEND_ABORT_ALL | OS_OPT_POST_NO_SCHED:
+             break;
+
+        default:
+            *p_err =  OS_ERR_OPT_INVALID;
+             return ((OS_OBJ_QTY)0u);
+    }
+#endif
+
+#if OS_CFG_OBJ_TYPE_CHK_EN > 0u
+    if (p_rwlock->Type != OS_OBJ_TYPE_RWLOCK) {
+       *p_err =  OS_ERR_OBJ_TYPE;
+        return ((OS_OBJ_QTY)0u);
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    if(rt_list_isempty(&p_rwlock->ReadWaitList) && rt_list_isempty(&p_rwlock->WriteWaitList))
+    {
+        CPU_CRITICAL_EXIT();
+       *p_err =  OS_ERR_PEND_ABORT_NONE;
+        return ((OS_OBJ_QTY)0u);
+    }
+
+    if(opt & OS_OPT_PEND_ABORT_ALL)
+    {
+        abort_tasks  = rt_ipc_pend_abort_all(&p_rwlock->WriteWaitList);
+        abort_tasks += rt_ipc_pend_abort_all(&p_rwlock->ReadWaitList);
+    }
+    else
+    {
+        if(rt_list_isempty(&p_rwlock->ReadWaitList))
+        {
+            p_list = &p_rwlock->WriteWaitList;
+        }
+        else if(rt_list_isempty(&p_rwlock->WriteWaitList))
+        {
+            p_list = &p_rwlock->ReadWaitList;
+        }
+        else                                                /* 两个链表都不为空,比较表头任务的优先级                  */
+        {
+            reader = rt_list_entry(p_rwlock->ReadWaitList.next, struct rt_thread, tlist);
+            writer = rt_list_entry(p_rwlock->WriteWaitList.next, struct rt_thread, tlist);
+            p_list = (reader->current_priority < writer->current_priority) ?
+                     &p_rwlock->ReadWaitList : &p_rwlock->WriteWaitList;
+        }
+        rt_ipc_pend_abort_1(p_list);
+        abort_tasks = 1;
+    }
+    (void)OS_RWLockGrant(p_rwlock);                         /* 写者退出等待后,读者可能可以获得读锁                    */
+#if OS_CFG_DBG_EN > 0u && !defined PKG_USING_UCOSIII_WRAPPER_TINY
+    OS_RWLockDbgNameUpd(p_rwlock);
+#endif
+    CPU_CRITICAL_EXIT();
+
+    if(!(opt & OS_OPT_POST_NO_SCHED))
+    {
+        rt_schedule();
+    }
+
+    *p_err = OS_ERR_NONE;
+    return abort_tasks;
+}
+#endif
+
+/*
+************************************************************************************************************************
+*                                            PEND ON A READER-WRITER LOCK FOR READING
+*
+* Description: This function waits for shared (read) access to a reader-writer lock.
+*
+* Arguments  : p_rwlock      is a pointer to the reader-writer lock
+*
+*              timeout       is an optional timeout period (in clock ticks).  If non-zero, your task will wait for the
+*                            lock up to the amount of time (in 'ticks') specified by this argument.  If you specify 0,
+*                            however, your task will wait forever at the specified lock or, until it becomes available.
+*
+*              opt           determines whether the user wants to block if the lock is not available or not:
+*
+*                                OS_OPT_PEND_BLOCKING
+*                                OS_OPT_PEND_NON_BLOCKING
+*
+*              p_ts          is a pointer to a variable that will receive the timestamp of when the lock was last
+*                            released.  If you pass a NULL pointer (i.e. (CPU_TS *)0) then you will not get the
+*                            timestamp.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE               The call was successful and your task holds a read lock
+*                                OS_ERR_OBJ_PTR_NULL       If 'p_rwlock' is a NULL pointer.
+*                                OS_ERR_OBJ_TYPE           If 'p_rwlock' is not pointing at a reader-writer lock
+*                                OS_ERR_OPT_INVALID        If you didn't specify a valid option
+*                                OS_ERR_OS_NOT_RUNNING     If uC/OS-III is not running yet
+*                                OS_ERR_PEND_ABORT         If the pend was aborted by another task
+*                                OS_ERR_PEND_ISR           If you called this function from an ISR
+*                                OS_ERR_PEND_WOULD_BLOCK   If you specified non-blocking but the lock was not available
+*                                OS_ERR_SCHED_LOCKED       If you called this function when the scheduler is locked
+*                                OS_ERR_TIMEOUT            The lock was not obtained within the specified timeout.
+*                              + OS_ERR_RT_ERROR           If the lock was deleted
+*                              + OS_ERR_RWLOCK_OWNER       If the calling task holds the write lock
+*                              + OS_ERR_RWLOCK_OVF         If the reader counter overflowed
+*
+* Returns    : none
+*
+* Note(s)    : 1) 没有任务持有或等待写锁时(快速路径),只在临界区内增加读者计数,不访问等待链表,也不调用调度器.
+************************************************************************************************************************
+*/
+
+void  OSRWLockReadPend (OS_RWLOCK  *p_rwlock,
+                        OS_TICK     timeout,
+                        OS_OPT      opt,
+                        CPU_TS     *p_ts,
+                        OS_ERR     *p_err)
+{
+    OS_TCB  *p_tcb;
+
+    CPU_SR_ALLOC();
+
+    if (p_ts != (CPU_TS *)0) {
+       *p_ts  = (CPU_TS  )0;                                /* Initialize the returned timestamp                      */
+    }
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u
+    if(OSIntNestingCtr > (OS_NESTING_CTR)0)                 /* 检查是否在中断中运行                                   */
+    {
+        *p_err = OS_ERR_PEND_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                 /* Is the kernel running?                                 */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return;
+    }
+#endif
+
+#if OS_CFG_ARG_CHK_EN > 0u
+    if(p_rwlock == RT_NULL)                                 /* 检查读写锁指针是否为空                                 */
+    {
+        *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    switch (opt) {
+        case OS_OPT_PEND_BLOCKING:
+        case OS_OPT_PEND_NON_BLOCKING:
+             break;
+
+        default:
+            *p_err = OS_ERR_OPT_INVALID;
+             return;
+    }
+#endif
+
+#if OS_CFG_OBJ_TYPE_CHK_EN > 0u
+    if(p_rwlock->Type != OS_OBJ_TYPE_RWLOCK)                /* 判断内核对象是否为读写锁                               */
+    {
+        *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    p_tcb = OSTCBCurPtr;
+
+    CPU_CRITICAL_ENTER();
+    /*快速路径:没有任务持有或等待写锁,直接获得读锁*/
+    if((p_rwlock->WriterTCBPtr == (OS_TCB *)0) && rt_list_isempty(&p_rwlock->WriteWaitList))
+    {
+        if(p_rwlock->ReaderCtr == (OS_OBJ_QTY)-1)           /* 读者计数溢出                                           */
+        {
+            CPU_CRITICAL_EXIT();
+            *p_err = OS_ERR_RWLOCK_OVF;
+            return;
+        }
+        p_rwlock->ReaderCtr++;
+#if OS_CFG_TS_EN > 0u
+        if(p_ts != (CPU_TS *)0)
+        {
+           *p_ts = p_rwlock->TS;
+        }
+#endif
+        CPU_CRITICAL_EXIT();
+        *p_err = OS_ERR_NONE;
+        return;
+    }
+
+    if(p_rwlock->WriterTCBPtr == p_tcb)                     /* 持有写锁的任务再申请读锁将导致死锁                     */
+    {
+        CPU_CRITICAL_EXIT();
+        *p_err = OS_ERR_RWLOCK_OWNER;
+        return;
+    }
+    if(opt & OS_OPT_PEND_NON_BLOCKING)
+    {
+        CPU_CRITICAL_EXIT();
+        *p_err = OS_ERR_PEND_WOULD_BLOCK;
+        return;
+    }
+    if(OSSchedLockNestingCtr > (OS_NESTING_CTR)0)           /* 检查调度器是否被锁                                     */
+    {
+        CPU_CRITICAL_EXIT();
+        *p_err = OS_ERR_SCHED_LOCKED;
+        return;
+    }
+
+    OS_RWLockBlock(p_rwlock, &p_rwlock->ReadWaitList, p_tcb, timeout);
+    CPU_CRITICAL_EXIT();
+
+    rt_schedule();                                          /* 等待OSRWLockWritePost()将读锁交给本任务,或超时         */
+
+    CPU_CRITICAL_ENTER();
+    p_tcb->TaskState &= ~OS_TASK_STATE_PEND;                /* 更新任务状态                                           */
+    p_tcb->PendOn     = OS_TASK_PEND_ON_NOTHING;            /* 清除当前任务等待状态                                   */
+#if OS_CFG_DBG_EN > 0u && !defined PKG_USING_UCOSIII_WRAPPER_TINY
+    p_tcb->DbgNamePtr = (CPU_CHAR *)((void *)" ");
+    OS_RWLockDbgNameUpd(p_rwlock);
+#endif
+    if(p_tcb->PendStatus == OS_STATUS_PEND_ABORT)           /* Indicate that we aborted                               */
+    {
+        CPU_CRITICAL_EXIT();
+        *p_err = OS_ERR_PEND_ABORT;
+        return;
+    }
+    *p_err = rt_err_to_ucosiii(p_tcb->Task.error);          /* RT_EOK表示读锁已经交给本任务                           */
+#if OS_CFG_TS_EN > 0u
+    if((*p_err == OS_ERR_NONE) && (p_ts != (CPU_TS *)0))
+    {
+       *p_ts = p_rwlock->TS;
+    }
+#endif
+    CPU_CRITICAL_EXIT();
+}
+
+/*
+************************************************************************************************************************
+*                                         RELEASE A READ LOCK ON A READER-WRITER LOCK
+*
+* Description: This function releases a read lock obtained by OSRWLockReadPend().
+*
+* Arguments  : p_rwlock  is a pointer to the reader-writer lock
+*
+*              opt       is an option you can specify to alter the behavior of the post.  The choices are:
+*
+*                            OS_OPT_POST_NONE        No special option selected
+*                            OS_OPT_POST_NO_SCHED    If you don't want the scheduler to be called after the post.
+*
+*              p_err     is a pointer to a variable that will contain an error code returned by this function.
+*
+*                            OS_ERR_NONE             The call was successful
+*                            OS_ERR_OBJ_PTR_NULL     If 'p_rwlock' is a NULL pointer.
+*                            OS_ERR_OBJ_TYPE         If 'p_rwlock' is not pointing at a reader-writer lock
+*                            OS_ERR_OPT_INVALID      If you specified an invalid option
+*                            OS_ERR_OS_NOT_RUNNING   If uC/OS-III is not running yet
+*                            OS_ERR_POST_ISR         If you attempted to post from an ISR
+*                          + OS_ERR_RWLOCK_NOT_OWNER If the lock has no reader
+*
+* Returns    : none
+************************************************************************************************************************
+*/
+
+void  OSRWLockReadPost (OS_RWLOCK  *p_rwlock,
+                        OS_OPT      opt,
+                        OS_ERR     *p_err)
+{
+    OS_OBJ_QTY  nbr_tasks;
+
+    CPU_SR_ALLOC();
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u
+    if(OSIntNestingCtr > (OS_NESTING_CTR)0)                 /* 检查是否在中断中运行                                   */
+    {
+        *p_err = OS_ERR_POST_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                 /* Is the kernel running?                                 */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return;
+    }
+#endif
+
+#if OS_CFG_ARG_CHK_EN > 0u
+    if(p_rwlock == RT_NULL)                                 /* 检查指针是否为空                                       */
+    {
+        *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    switch (opt) {
+        case OS_OPT_POST_NONE:
+        case OS_OPT_POST_NO_SCHED:
+             break;
+
+        default:
+            *p_err =  OS_ERR_OPT_INVALID;
+             return;
+    }
+#endif
+
+#if OS_CFG_OBJ_TYPE_CHK_EN > 0u
+    if(p_rwlock->Type != OS_OBJ_TYPE_RWLOCK)                /* 判断内核对象是否为读写锁                               */
+    {
+        *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    nbr_tasks = (OS_OBJ_QTY)0;
+    CPU_CRITICAL_ENTER();
+    if(p_rwlock->ReaderCtr == (OS_OBJ_QTY)0)                /* 读写锁没有被读者持有                                   */
+    {
+        CPU_CRITICAL_EXIT();
+        *p_err = OS_ERR_RWLOCK_NOT_OWNER;
+        return;
+    }
+    p_rwlock->ReaderCtr--;
+#if OS_CFG_TS_EN > 0u
+    p_rwlock->TS = OS_PostTS();
+#endif
+    if(p_rwlock->ReaderCtr == (OS_OBJ_QTY)0)                /* 最后一个读者,将写锁交给等待的写者                      */
+    {
+        nbr_tasks = OS_RWLockGrant(p_rwlock);
+    }
+    CPU_CRITICAL_EXIT();
+
+    if((nbr_tasks > (OS_OBJ_QTY)0) && !(opt & OS_OPT_POST_NO_SCHED))
+    {
+        rt_schedule();
+    }
+    *p_err = OS_ERR_NONE;
+}
+
+/*
+************************************************************************************************************************
+*                                            PEND ON A READER-WRITER LOCK FOR WRITING
+*
+* Description: This function waits for exclusive (write) access to a reader-writer lock.
+*
+* Arguments  : p_rwlock      is a pointer to the reader-writer lock
+*
+*              timeout       is an optional timeout period (in clock ticks).  If non-zero, your task will wait for the
+*                            lock up to the amount of time (in 'ticks') specified by this argument.  If you specify 0,
+*                            however, your task will wait forever at the specified lock or, until it becomes available.
+*
+*              opt           determines whether the user wants to block if the lock is not available or not:
+*
+*                                OS_OPT_PEND_BLOCKING
+*                                OS_OPT_PEND_NON_BLOCKING
+*
+*              p_ts          is a pointer to a variable that will receive the timestamp of when the lock was last
+*                            released.  If you pass a NULL pointer (i.e. (CPU_TS *)0) then you will not get the
+*                            timestamp.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE               The call was successful and your task owns the write lock
+*                                OS_ERR_OBJ_PTR_NULL       If 'p_rwlock' is a NULL pointer.
+*                                OS_ERR_OBJ_TYPE           If 'p_rwlock' is not pointing at a reader-writer lock
+*                                OS_ERR_OPT_INVALID        If you didn't specify a valid option
+*                                OS_ERR_OS_NOT_RUNNING     If uC/OS-III is not running yet
+*                                OS_ERR_PEND_ABORT         If the pend was aborted by another task
+*                                OS_ERR_PEND_ISR           If you called this function from an ISR
+*                                OS_ERR_PEND_WOULD_BLOCK   If you specified non-blocking but the lock was not available
+*                                OS_ERR_SCHED_LOCKED       If you called this function when the scheduler is locked
+*                                OS_ERR_TIMEOUT            The lock was not obtained within the specified timeout.
+*                              + OS_ERR_RT_ERROR           If the lock was deleted
+*                              + OS_ERR_RWLOCK_OWNER       If the calling task already holds the write lock
+*
+* Returns    : none
+*
+* Note(s)    : 1) 等待写锁的任务放弃等待(超时或被OSRWLockPendAbort()放弃)后,若已经没有其他写者,则唤醒因写者优先
+*                 而等待的读者.
+************************************************************************************************************************
+*/
+
+void  OSRWLockWritePend (OS_RWLOCK  *p_rwlock,
+                         OS_TICK     timeout,
+                         OS_OPT      opt,
+                         CPU_TS     *p_ts,
+                         OS_ERR     *p_err)
+{
+    OS_TCB      *p_tcb;
+    OS_OBJ_QTY   nbr_tasks;
+
+    CPU_SR_ALLOC();
+
+    if (p_ts != (CPU_TS *)0) {
+       *p_ts  = (CPU_TS  )0;                                /* Initialize the returned timestamp                      */
+    }
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u
+    if(OSIntNestingCtr > (OS_NESTING_CTR)0)                 /* 检查是否在中断中运行                                   */
+    {
+        *p_err = OS_ERR_PEND_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                 /* Is the kernel running?                                 */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return;
+    }
+#endif
+
+#if OS_CFG_ARG_CHK_EN > 0u
+    if(p_rwlock == RT_NULL)                                 /* 检查读写锁指针是否为空                                 */
+    {
+        *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    switch (opt) {
+        case OS_OPT_PEND_BLOCKING:
+        case OS_OPT_PEND_NON_BLOCKING:
+             break;
+
+        default:
+            *p_err = OS_ERR_OPT_INVALID;
+             return;
+    }
+#endif
+
+#if OS_CFG_OBJ_TYPE_CHK_EN > 0u
+    if(p_rwlock->Type != OS_OBJ_TYPE_RWLOCK)                /* 判断内核对象是否为读写锁                               */
+    {
+        *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    p_tcb = OSTCBCurPtr;
+
+    CPU_CRITICAL_ENTER();
+    if((p_rwlock->WriterTCBPtr == (OS_TCB *)0) && (p_rwlock->ReaderCtr == (OS_OBJ_QTY)0))
+    {
+        p_rwlock->WriterTCBPtr = p_tcb;                     /* 读写锁空闲,直接获得写锁                                */
+#if OS_CFG_TS_EN > 0u
+        if(p_ts != (CPU_TS *)0)
+        {
+           *p_ts = p_rwlock->TS;
+        }
+#endif
+        CPU_CRITICAL_EXIT();
+        *p_err = OS_ERR_NONE;
+        return;
+    }
+
+    if(p_rwlock->WriterTCBPtr == p_tcb)                     /* 写锁不支持嵌套                                         */
+    {
+        CPU_CRITICAL_EXIT();
+        *p_err = OS_ERR_RWLOCK_OWNER;
+        return;
+    }
+    if(opt & OS_OPT_PEND_NON_BLOCKING)
+    {
+        CPU_CRITICAL_EXIT();
+        *p_err = OS_ERR_PEND_WOULD_BLOCK;
+        return;
+    }
+    if(OSSchedLockNestingCtr > (OS_NESTING_CTR)0)           /* 检查调度器是否被锁                                     */
+    {
+        CPU_CRITICAL_EXIT();
+        *p_err = OS_ERR_SCHED_LOCKED;
+        return;
+    }
+
+    OS_RWLockBlock(p_rwlock, &p_rwlock->WriteWaitList, p_tcb, timeout);
+    CPU_CRITICAL_EXIT();
+
+    rt_schedule();                                          /* 等待写锁被交给本任务,或超时                            */
+
+    CPU_CRITICAL_ENTER();
+    p_tcb->TaskState &= ~OS_TASK_STATE_PEND;                /* 更新任务状态                                           */
+    p_tcb->PendOn     = OS_TASK_PEND_ON_NOTHING;            /* 清除当前任务等待状态                                   */
+    if(p_tcb->PendStatus == OS_STATUS_PEND_ABORT)           /* Indicate that we aborted                               */
+    {
+        *p_err = OS_ERR_PEND_ABORT;
+    }
+    else
+    {
+        *p_err = rt_err_to_ucosiii(p_tcb->Task.error);      /* RT_EOK表示写锁已经交给本任务                           */
+    }
+    nbr_tasks = (OS_OBJ_QTY)0;
+    if(*p_err != OS_ERR_NONE)
+    {
+        nbr_tasks = OS_RWLockGrant(p_rwlock);               /* 本任务不再等待,被本任务挡住的读者可能可以获得读锁      */
+    }
+#if OS_CFG_TS_EN > 0u
+    else if(p_ts != (CPU_TS *)0)
+    {
+       *p_ts = p_rwlock->TS;
+    }
+#endif
+#if OS_CFG_DBG_EN > 0u && !defined PKG_USING_UCOSIII_WRAPPER_TINY
+    p_tcb->DbgNamePtr = (CPU_CHAR *)((void *)" ");
+    OS_RWLockDbgNameUpd(p_rwlock);
+#endif
+    CPU_CRITICAL_EXIT();
+
+    if(nbr_tasks > (OS_OBJ_QTY)0)
+    {
+        rt_schedule();
+    }
+}
+
+/*
+************************************************************************************************************************
+*                                        RELEASE THE WRITE LOCK ON A READER-WRITER LOCK
+*
+* Description: This function releases the write lock obtained by OSRWLockWritePend().
+*
+* Arguments  : p_rwlock  is a pointer to the reader-writer lock
+*
+*              opt       is an option you can specify to alter the behavior of the post.  The choices are:
+*
+*                            OS_OPT_POST_NONE        No special option selected
+*                            OS_OPT_POST_NO_SCHED    If you don't want the scheduler to be called after the post.
+*
+*              p_err     is a pointer to a variable that will contain an error code returned by this function.
+*
+*                            OS_ERR_NONE             The call was successful
+*                            OS_ERR_OBJ_PTR_NULL     If 'p_rwlock' is a NULL pointer.
+*                            OS_ERR_OBJ_TYPE         If 'p_rwlock' is not pointing at a reader-writer lock
+*                            OS_ERR_OPT_INVALID      If you specified an invalid option
+*                            OS_ERR_OS_NOT_RUNNING   If uC/OS-III is not running yet
+*                            OS_ERR_POST_ISR         If you attempted to post from an ISR
+*                          + OS_ERR_RWLOCK_NOT_OWNER If the calling task does not hold the write lock
+*
+* Returns    : none
+************************************************************************************************************************
+*/
+
+void  OSRWLockWritePost (OS_RWLOCK  *p_rwlock,
+                         OS_OPT      opt,
+                         OS_ERR     *p_err)
+{
+    OS_OBJ_QTY  nbr_tasks;
+
+    CPU_SR_ALLOC();
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u
+    if(OSIntNestingCtr > (OS_NESTING_CTR)0)                 /* 检查是否在中断中运行                                   */
+    {
+        *p_err = OS_ERR_POST_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                 /* Is the kernel running?                                 */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return;
+    }
+#endif
+
+#if OS_CFG_ARG_CHK_EN > 0u
+    if(p_rwlock == RT_NULL)                                 /* 检查指针是否为空                                       */
+    {
+        *p_err = OS_ERR_OBJ_PTR_NULL;
+        return;
+    }
+    switch (opt) {
+        case OS_OPT_POST_NONE:
+        case OS_OPT_POST_NO_SCHED:
+             break;
+
+        default:
+            *p_err =  OS_ERR_OPT_INVALID;
+             return;
+    }
+#endif
+
+#if OS_CFG_OBJ_TYPE_CHK_EN > 0u
+    if(p_rwlock->Type != OS_OBJ_TYPE_RWLOCK)                /* 判断内核对象是否为读写锁                               */
+    {
+        *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    if(p_rwlock->WriterTCBPtr != OSTCBCurPtr)               /* 只有持有写锁的任务才能释放                             */
+    {
+        CPU_CRITICAL_EXIT();
+        *p_err = OS_ERR_RWLOCK_NOT_OWNER;
+        return;
+    }
+    p_rwlock->WriterTCBPtr = (OS_TCB *)0;
+#if OS_CFG_TS_EN > 0u
+    p_rwlock->TS = OS_PostTS();
+#endif
+    nbr_tasks = OS_RWLockGrant(p_rwlock);                   /* 交给下一个写者,或者所有等待的读者                      */
+    CPU_CRITICAL_EXIT();
+
+    if((nbr_tasks > (OS_OBJ_QTY)0) && !(opt & OS_OPT_POST_NO_SCHED))
+    {
+        rt_schedule();
+    }
+    *p_err = OS_ERR_NONE;
+}
+
+/*
+************************************************************************************************************************
+*                                      BLOCK THE CURRENT TASK ON A READER-WRITER LOCK
+*
+* Description: This function suspends the current task and inserts it into one of the wait lists of the reader-writer
+*              lock in priority order, then starts the task's own timer if a timeout was specified.
+*
+* Arguments  : p_rwlock    is a pointer to the reader-writer lock
+*
+*              p_list      is the wait list to insert the task into (.ReadWaitList or .WriteWaitList)
+*
+*              p_tcb       is a pointer to the TCB of the current task
+*
+*              timeout     is the timeout in ticks, 0 means wait forever
+*
+* Returns    : none
+*
+* Note(s)    : 1) 必须在关中断(临界区)内调用,调用者退出临界区后调用rt_schedule()让出CPU.
+************************************************************************************************************************
+*/
+
+static  void  OS_RWLockBlock (OS_RWLOCK  *p_rwlock,
+                              rt_list_t  *p_list,
+                              OS_TCB     *p_tcb,
+                              OS_TICK     timeout)
+{
+    rt_tick_t  time;
+
+
+    p_tcb->PendStatus  = OS_STATUS_PEND_OK;                 /* Clear pend status                                      */
+    p_tcb->TaskState  |= OS_TASK_STATE_PEND;
+    p_tcb->PendOn      = OS_TASK_PEND_ON_RWLOCK;
+    p_tcb->Task.error  = RT_EOK;                            /* 被OS_RWLockGrant()唤醒时保持RT_EOK                     */
+#if OS_CFG_DBG_EN > 0u && !defined PKG_USING_UCOSIII_WRAPPER_TINY
+    p_tcb->DbgNamePtr  = p_rwlock->NamePtr;
+#else
+    (void)p_rwlock;
+#endif
+
+    rt_thread_suspend(&p_tcb->Task);                        /* 从就绪表中移除,tlist可以挂到等待链表上                 */
+    rt_ipc_list_insert_prio(p_list, &p_tcb->Task);
+
+    if (timeout > (OS_TICK)0) {                             /* 在uCOS-III中timeout=0表示永久阻塞                      */
+        time = timeout;
+        rt_timer_control(&p_tcb->Task.thread_timer, RT_TIMER_CTRL_SET_TIME, &time);
+        rt_timer_start(&p_tcb->Task.thread_timer);          /* 超时后rt_thread_timeout()将任务移出等待链表            */
+    }
+#if OS_CFG_DBG_EN > 0u && !defined PKG_USING_UCOSIII_WRAPPER_TINY
+    OS_RWLockDbgNameUpd(p_rwlock);
+#endif
+}
+
+/*
+************************************************************************************************************************
+*                                        HAND A FREE READER-WRITER LOCK TO WAITING TASKS
+*
+* Description: This function is called when the write lock is released, the last reader releases its read lock or a
+*              writer stops waiting.  If nobody holds the write lock, it hands the write lock to the highest priority
+*              waiting writer when there are no readers left, or, when no writer is waiting, hands a read lock to every
+*              waiting reader.
+*
+* Arguments  : p_rwlock    is a pointer to the reader-writer lock
+*
+* Returns    : the number of tasks readied.
+*
+* Note(s)    : 1) 必须在关中断(临界区)内调用,是否调度由调用者决定.
+*
+*              2) 锁的所有权在这里直接转移给被唤醒的任务,被唤醒的任务不需要再次检查锁的状态.
+************************************************************************************************************************
+*/
+
+static  OS_OBJ_QTY  OS_RWLockGrant (OS_RWLOCK  *p_rwlock)
+{
+    struct rt_thread  *thread;
+    OS_OBJ_QTY         nbr_tasks;
+
+
+    nbr_tasks = (OS_OBJ_QTY)0;
+    if (p_rwlock->WriterTCBPtr != (OS_TCB *)0) {            /* 写锁仍被持有                                           */
+        return (nbr_tasks);
+    }
+
+    if (!rt_list_isempty(&p_rwlock->WriteWaitList)) {       /* 写者优先                                               */
+        if (p_rwlock->ReaderCtr == (OS_OBJ_QTY)0) {
+            thread = rt_list_entry(p_rwlock->WriteWaitList.next, struct rt_thread, tlist);
+            p_rwlock->WriterTCBPtr = (OS_TCB *)thread;
+            rt_thread_resume(thread);                       /* 从等待链表中移除并就绪                                 */
+            nbr_tasks++;
+        }
+    } else {
+        while (!rt_list_isempty(&p_rwlock->ReadWaitList)) { /* 没有写者,所有读者同时获得读锁                         */
+            thread = rt_list_entry(p_rwlock->ReadWaitList.next, struct rt_thread, tlist);
+            p_rwlock->ReaderCtr++;
+            rt_thread_resume(thread);
+            nbr_tasks++;
+        }
+    }
+#if OS_CFG_DBG_EN > 0u && !defined PKG_USING_UCOSIII_WRAPPER_TINY
+    OS_RWLockDbgNameUpd(p_rwlock);
+#endif
+    return (nbr_tasks);
+}
+
+/*
+************************************************************************************************************************
+*                                     UPDATE THE NAME OF THE FIRST TASK WAITING ON THE LOCK
+*
+* Description: This function sets .DbgNamePtr to the name of the highest priority writer waiting on the lock, or the
+*              highest priority reader if no writer is waiting.
+*
+* Arguments  : p_rwlock    is a pointer to the reader-writer lock
+*
+* Returns    : none
+*
+* Note(s)    : 1) 必须在关中断(临界区)内调用.
+************************************************************************************************************************
+*/
+
+#if OS_CFG_DBG_EN > 0u && !defined PKG_USING_UCOSIII_WRAPPER_TINY
+static  void  OS_RWLockDbgNameUpd (OS_RWLOCK  *p_rwlock)
+{
+    struct rt_thread  *thread;
+
+
+    if (!rt_list_isempty(&p_rwlock->WriteWaitList)) {
+        thread = rt_list_entry(p_rwlock->WriteWaitList.next, struct rt_thread, tlist);
+        p_rwlock->DbgNamePtr = thread->name;
+    } else if (!rt_list_isempty(&p_rwlock->ReadWaitList)) {
+        thread = rt_list_entry(p_rwlock->ReadWaitList.next, struct rt_thread, tlist);
+        p_rwlock->DbgNamePtr = thread->name;
+    } else {
+        p_rwlock->DbgNamePtr = (CPU_CHAR *)((void *)" ");   /* 若为空,则清空当前.DbgNamePtr                           */
+    }
+}
+#endif
+
+/*
+************************************************************************************************************************
+*                                       CLEAR THE CONTENTS OF A READER-WRITER LOCK
+*
+* Description: This function is called by OSRWLockDel() to clear the contents of a reader-writer lock
+*
+
+* Argument(s): p_rwlock     is a pointer to the reader-writer lock to clear
+*              --------
+*
+* Returns    : none
+*
+* Note(s)    : This function is INTERNAL to uC/OS-III and your application should not call it.
+************************************************************************************************************************
+*/
+
+void  OS_RWLockClr (OS_RWLOCK  *p_rwlock)
+{
+    p_rwlock->Type         =  OS_OBJ_TYPE_NONE;             /* Mark the data structure as a NONE                      */
+    p_rwlock->ReaderCtr    = (OS_OBJ_QTY)0;
+    p_rwlock->WriterTCBPtr = (OS_TCB   *)0;
+#if OS_CFG_TS_EN > 0u
+    p_rwlock->TS           = (CPU_TS    )0;
+#endif
+#ifndef PKG_USING_UCOSIII_WRAPPER_TINY
+#if (OS_CFG_DBG_EN > 0u)
+    p_rwlock->NamePtr      = (CPU_CHAR *)((void *)"?RWLOCK");
+#endif
+#endif
+}
+
+/*
+************************************************************************************************************************
+*                                    ADD/REMOVE READER-WRITER LOCK TO/FROM DEBUG LIST
+*
+* Description: These functions are called by uC/OS-III to add or remove a reader-writer lock to/from the debug list.
+*
+* Arguments  : p_rwlock    is a pointer to the reader-writer lock to add/remove
+*
+* Returns    : none
+*
+* Note(s)    : These functions are INTERNAL to uC/OS-III and your application should not call it.
+************************************************************************************************************************
+*/
+
+#if OS_CFG_DBG_EN > 0u && !defined PKG_USING_UCOSIII_WRAPPER_TINY
+void  OS_RWLockDbgListAdd (OS_RWLOCK  *p_rwlock)
+{
+    p_rwlock->DbgNamePtr               = (CPU_CHAR  *)((void *)" ");
+    p_rwlock->DbgPrevPtr               = (OS_RWLOCK *)0;
+    if (OSRWLockDbgListPtr == (OS_RWLOCK *)0) {
+        p_rwlock->DbgNextPtr           = (OS_RWLOCK *)0;
+    } else {
+        p_rwlock->DbgNextPtr           =  OSRWLockDbgListPtr;
+        OSRWLockDbgListPtr->DbgPrevPtr =  p_rwlock;
+    }
+    OSRWLockDbgListPtr                 =  p_rwlock;
+}
+
+
+
+void  OS_RWLockDbgListRemove (OS_RWLOCK  *p_rwlock)
+{
+    OS_RWLOCK  *p_rwlock_next;
+    OS_RWLOCK  *p_rwlock_prev;
+
+    p_rwlock->DbgNamePtr               = (CPU_CHAR *)((void *)" ");
+    p_rwlock_prev = p_rwlock->DbgPrevPtr;
+    p_rwlock_next = p_rwlock->DbgNextPtr;
+
+    if (p_rwlock_prev == (OS_RWLOCK *)0) {
+        OSRWLockDbgListPtr = p_rwlock_next;
+        if (p_rwlock_next != (OS_RWLOCK *)0) {
+            p_rwlock_next->DbgPrevPtr = (OS_RWLOCK *)0;
+        }
+        p_rwlock->DbgNextPtr = (OS_RWLOCK *)0;
+
+    } else if (p_rwlock_next == (OS_RWLOCK *)0) {
+        p_rwlock_prev->DbgNextPtr = (OS_RWLOCK *)0;
+        p_rwlock->DbgPrevPtr      = (OS_RWLOCK *)0;
+
+    } else {
+        p_rwlock_prev->DbgNextPtr =  p_rwlock_next;
+        p_rwlock_next->DbgPrevPtr =  p_rwlock_prev;
+        p_rwlock->DbgNextPtr      = (OS_RWLOCK *)0;
+        p_rwlock->DbgPrevPtr      = (OS_RWLOCK *)0;
+    }
+}
+#endif
+
+/*
+************************************************************************************************************************
+*                                           READER-WRITER LOCK INITIALIZATION
+*
+* Description: This function is called by OSInit() to initialize the reader-writer lock management.
+*
+
+* Argument(s): p_err        is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE     the call was successful
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+void  OS_RWLockInit (OS_ERR  *p_err)
+{
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#ifndef PKG_USING_UCOSIII_WRAPPER_TINY
+#if OS_CFG_DBG_EN > 0u
+    OSRWLockDbgListPtr = (OS_RWLOCK *)0;
+#endif
+    OSRWLockQty        = (OS_OBJ_QTY)0;
+#endif
+   *p_err              =  OS_ERR_NONE;
+}
+
+#endif
@@ -159,6 +159,13 @@ void  OSSemCreate (OS_SEM      *p_sem,
     {
         return;
     }
+#if OS_CFG_TS_EN > 0u
+    p_sem->TS = (CPU_TS)0;
+#endif
+#if OS_CFG_OBJ_STAT_EN > 0u
+    OS_ObjStatClr(&p_sem->Stat);
+#endif
+    OS_TRACE_NAME(p_sem, p_name);
 
 #ifndef PKG_USING_UCOSIII_WRAPPER_TINY
     CPU_CRITICAL_ENTER();
@@ -388,10 +395,16 @@ OS_SEM_CTR  OSSemPend (OS_SEM   *p_sem,
 #if OS_CFG_DBG_EN > 0u && !defined PKG_USING_UCOSIII_WRAPPER_TINY
     rt_thread_t thread;
 #endif
+#if OS_CFG_OBJ_STAT_EN > 0u
+    CPU_BOOLEAN stat_blk;
+    OS_TICK stat_start = 0u;
+#endif
 
     CPU_SR_ALLOC();
 
-    CPU_VAL_UNUSED(p_ts);
+    if (p_ts != (CPU_TS *)0) {
+       *p_ts  = (CPU_TS  )0;                                /* Initialize the returned timestamp                      */
+    }
 
 #ifdef OS_SAFETY_CRITICAL
     if (p_err == (OS_ERR *)0) {
@@ -481,17 +494,40 @@ OS_SEM_CTR  OSSemPend (OS_SEM   *p_sem,
     p_sem->DbgNamePtr = p_tcb->Task.name;
 #endif
     p_sem->Ctr = p_sem->Sem.value;                          /* 更新信号量的value                                      */
+#endif
+#if OS_CFG_OBJ_STAT_EN > 0u
+    p_sem->Stat.PendCtr++;
+    stat_blk = DEF_FALSE;
+    if((time != RT_WAITING_NO) && (p_sem->Sem.value == 0u))
+    {
+        stat_blk = DEF_TRUE;                                /* 资源不可用,需要阻塞(慢速路径)                          */
+        stat_start = OS_ObjStatPendBlock(&p_sem->Stat);
+    }
 #endif
     CPU_CRITICAL_EXIT();
 
+    OS_TRACE(OS_TRACE_EV_SEM_PEND, p_sem, timeout);
     rt_err = rt_sem_take(&p_sem->Sem,time);
     *p_err = rt_err_to_ucosiii(rt_err);
+    OS_TRACE(OS_TRACE_EV_SEM_PEND_EXIT, p_sem, *p_err);
+#if OS_CFG_OBJ_STAT_EN > 0u
+    if(stat_blk == DEF_TRUE)
+    {
+        OS_ObjStatPendEnd(&p_sem->Stat, stat_start, p_tcb, *p_err);
+    }
+#endif
     if(*p_err == OS_ERR_TIMEOUT && time == RT_WAITING_NO)
     {
         *p_err = OS_ERR_PEND_WOULD_BLOCK;
     }
 
     CPU_CRITICAL_ENTER();
+#if OS_CFG_TS_EN > 0u
+    if(rt_err == RT_EOK && p_ts != (CPU_TS *)0)
+    {
+       *p_ts = p_sem->TS;                                   /* 返回信号量被发布时的时间戳                             */
+    }
+#endif
     p_tcb->TaskState &= ~OS_TASK_STATE_PEND;                /* 更新任务状态                                           */
     p_tcb->PendOn = OS_TASK_PEND_ON_NOTHING;                /* 清除当前任务等待状态                                   */
 #ifndef PKG_USING_UCOSIII_WRAPPER_TINY
@@ -749,6 +785,26 @@ OS_SEM_CTR  OSSemPost (OS_SEM  *p_sem,
     }
 #endif
 
+    OS_TRACE(OS_TRACE_EV_SEM_POST, p_sem, opt);
+
+#if OS_CFG_ISR_POST_DEFERRED_EN > 0u
+    if (OSIntNestingCtr > (OS_NESTING_CTR)0) {              /* See if called from an ISR                              */
+        OS_IntQPost((OS_OBJ_TYPE)OS_OBJ_TYPE_SEM,           /* Post to ISR queue                                      */
+                    (void      *)p_sem,
+                    (void      *)0,
+                    (OS_MSG_SIZE)0,
+                    (OS_FLAGS   )0,
+                    (OS_PRIO    )0,
+                    (OS_OPT     )opt,
+                    (CPU_TS     )OS_TS_GET(),
+                    (OS_ERR    *)p_err);
+        return ((OS_SEM_CTR)0);
+    }
+#endif
+
+#if OS_CFG_TS_EN > 0u
+    p_sem->TS = OS_PostTS();                                /* 先记录时间戳,被唤醒的任务可能立即运行                  */
+#endif
     if(opt & OS_OPT_POST_ALL)
     {
         rt_err = rt_sem_release_all(&p_sem->Sem);
@@ -57,6 +57,14 @@
 #include "os.h"
 
 #if OS_CFG_STAT_TASK_EN > 0u
+
+#if (OS_CFG_STAT_TASK_TS_EN > 0u) || \
+    (OS_CFG_TASK_PROFILE_EN > 0u && OS_CFG_DBG_EN > 0u && !defined PKG_USING_UCOSIII_WRAPPER_TINY)
+#define  OS_STAT_TS_EN             1u                       /* 统计任务需要以时间戳计算统计周期                         */
+#else
+#define  OS_STAT_TS_EN             0u
+#endif
+
 /*
 ************************************************************************************************************************
 *                                                   RESET STATISTICS
@@ -90,6 +98,15 @@ void  OSStatReset (OS_ERR  *p_err)
 #if OS_CFG_STAT_TASK_EN > 0u
     OSStatTaskCPUUsageMax = 0u;
     OSStatTaskCPUUsage    = 0u;
+#endif
+#if OS_CFG_SCHED_LOCK_TIME_MEAS_EN > 0u
+    OSSchedLockTimeMax        = (CPU_TS)0;
+    OSSchedLockTimeMaxCur     = (CPU_TS)0;
+    OSSchedLockTimeMaxName[0] = '\0';
+#endif
+#if OS_CFG_TMR_EN > 0u && !defined PKG_USING_UCOSIII_WRAPPER_TINY
+    OSTmrExpireCtr            = (OS_CTR)0;                  /* 重新开始统计定时器的唤醒次数                           */
+    OSTmrWakeupCtr            = (OS_CTR)0;
 #endif
     CPU_CRITICAL_EXIT();
 
@@ -103,6 +120,9 @@ void  OSStatReset (OS_ERR  *p_err)
         p_tcb->CPUUsage         = (OS_CPU_USAGE)0;
         p_tcb->CPUUsageMax      = (OS_CPU_USAGE)0;
 #endif
+#ifdef CPU_CFG_INT_DIS_MEAS_EN
+        p_tcb->IntDisTimeMax    = (CPU_TS      )0;
+#endif
 
         p_tcb                   = p_tcb->DbgNextPtr;
         CPU_CRITICAL_EXIT();
@@ -130,13 +150,23 @@ void  OSStatReset (OS_ERR  *p_err)
 *                             OS_ERR_OS_NOT_RUNNING    If uC/OS-III is not running yet
 *
 * Returns    : none
+*
+* Note(s)    : 1) OS_CFG_STAT_TASK_TS_EN使能时,CPU使用率由RT-Thread空闲线程的运行时间(时间戳差值)直接计算:
+*
+*                                              空闲线程运行时间
+*                 CPU Usage (%) = 100 * (1 - --------------------)
+*                                               统计周期时间戳跨度
+*
+*                 此时不需要校准OSStatTaskCtrMax,本函数将立即返回.
 ************************************************************************************************************************
 */
 
 void  OSStatTaskCPUUsageInit (OS_ERR  *p_err)
 {
+#if OS_CFG_STAT_TASK_TS_EN == 0u
     OS_ERR err;
     OS_TICK  dly;
+#endif
 
     CPU_SR_ALLOC();
 
@@ -154,6 +184,12 @@ void  OSStatTaskCPUUsageInit (OS_ERR  *p_err)
     }
 #endif
 
+#if OS_CFG_STAT_TASK_TS_EN > 0u
+    CPU_CRITICAL_ENTER();
+    OSStatTaskRdy     = OS_STATE_RDY;                       /* 空闲时间由时间戳直接测量,无需校准OSStatTaskCtrMax      */
+    CPU_CRITICAL_EXIT();
+   *p_err             = OS_ERR_NONE;
+#else
     OSTimeDly((OS_TICK )2,                                  /* Synchronize with clock tick                            */
               (OS_OPT  )OS_OPT_TIME_PERIODIC,
               (OS_ERR *)&err);
@@ -181,6 +217,7 @@ void  OSStatTaskCPUUsageInit (OS_ERR  *p_err)
     OSStatTaskRdy     = OS_STATE_RDY;
     CPU_CRITICAL_EXIT();
    *p_err             = OS_ERR_NONE;
+#endif
 }
 
 /*
@@ -206,6 +243,10 @@ void  OSStatTaskCPUUsageInit (OS_ERR  *p_err)
 *                 for the idle counter.
 *
 *              4) This function is INTERNAL to uC/OS-III and your application should not call it.
+*
+*              5) 任务和定时器的统计(堆栈检查、SP、各任务CPU使用率、定时器剩余时间)分摊到OS_CFG_STAT_TASK_SWEEP_PERIODS
+*                 个统计周期内完成:每个周期最多处理总数/OS_CFG_STAT_TASK_SWEEP_PERIODS(向上取整)个对象,游标
+*                 OSStatTaskTCBCursorPtr/OSStatTaskTmrCursorPtr记录下一个要处理的对象,对象被删除时游标自动后移.
 ************************************************************************************************************************
 */
 
@@ -216,10 +257,25 @@ void  OS_StatTask (void  *p_arg)
 #if OS_CFG_TMR_EN > 0u
     OS_TMR      *p_tmr;
 #endif
+    OS_OBJ_QTY   budget;
+#if OS_CFG_TASK_PROFILE_EN > 0u
+    CPU_TS       ts_task;
+#endif
+#endif
+#if OS_STAT_TS_EN > 0u
+    CPU_TS       ts_now;
+    CPU_INT64U   usage;
 #endif
+#if OS_CFG_STAT_TASK_TS_EN > 0u
+    CPU_TS       ts_prev;
+    CPU_TS       ts_delta;
+    OS_CYCLES    idle_now;
+    OS_CYCLES    idle_prev;
+#else
     OS_TICK      ctr_max;
     OS_TICK      ctr_mult;
     OS_TICK      ctr_div;
+#endif
     OS_ERR       err;
     OS_TICK      dly;
 
@@ -233,6 +289,12 @@ void  OS_StatTask (void  *p_arg)
                   &err);
     }
     OSStatReset(&err);                                      /* Reset statistics                                       */
+#if OS_CFG_STAT_TASK_TS_EN > 0u
+    CPU_CRITICAL_ENTER();
+    ts_prev   = OS_TS_GET();
+    idle_prev = OSStatTaskIdleCycles;
+    CPU_CRITICAL_EXIT();
+#endif
 
     dly = (OS_TICK)0;                                       /* Compute statistic task sleep delay                     */
     if (OS_CFG_TICK_RATE_HZ > OS_CFG_STAT_TASK_RATE_HZ) {
@@ -243,6 +305,28 @@ void  OS_StatTask (void  *p_arg)
     }
 
     while (DEF_ON) {
+#if OS_CFG_STAT_TASK_TS_EN > 0u
+        CPU_CRITICAL_ENTER();
+        ts_now    = OS_TS_GET();
+        idle_now  = OSStatTaskIdleCycles;
+        CPU_CRITICAL_EXIT();
+        ts_delta  = ts_now - ts_prev;                       /* 本统计周期的时间戳跨度                                 */
+        ts_prev   = ts_now;
+#endif
+
+#if OS_CFG_STAT_TASK_TS_EN > 0u
+        if (ts_delta > (CPU_TS)0) {                         /* ----------------- OVERALL CPU USAGE ------------------ */
+            usage = ((CPU_INT64U)(OS_CYCLES)(idle_now - idle_prev) * 10000u) / ts_delta;
+            if (usage > 10000u) {                           /* Idle time of the past period, in units of 0.01%        */
+                usage = 10000u;
+            }
+            OSStatTaskCPUUsage = (OS_CPU_USAGE)(10000u - usage);
+            if (OSStatTaskCPUUsageMax < OSStatTaskCPUUsage) {
+                OSStatTaskCPUUsageMax = OSStatTaskCPUUsage;
+            }
+        }
+        idle_prev = idle_now;
+#else
         CPU_CRITICAL_ENTER();                               /* ----------------- OVERALL CPU USAGE ------------------ */
         OSStatTaskCtrRun   = OSStatTaskCtr;                 /* Obtain the of the stat counter for the past .1 second  */
         OSStatTaskCtr      = (OS_TICK)0;                    /* Reset the stat counter for the next .1 second          */
@@ -271,38 +355,80 @@ void  OS_StatTask (void  *p_arg)
                 OSStatTaskCPUUsageMax = OSStatTaskCPUUsage;
             }
         }
+#endif
 
         OSStatTaskHook();                                   /* Invoke user definable hook                             */
 
+#if (CPU_CFG_TS_EN == DEF_ENABLED)
+        CPU_TS_Update();                                    /* 周期性更新64位时间戳,防止时间戳定时器溢出后丢失计数    */
+#endif
+
 #if OS_CFG_DBG_EN > 0u && !defined PKG_USING_UCOSIII_WRAPPER_TINY
         /*--------------任务TCB------------------*/
         CPU_CRITICAL_ENTER();
-        p_tcb = OSTaskDbgListPtr;
+        budget = (OS_OBJ_QTY)((OSTaskQty + OS_CFG_STAT_TASK_SWEEP_PERIODS - 1u) / OS_CFG_STAT_TASK_SWEEP_PERIODS);
+        if (OSStatTaskTCBCursorPtr == (OS_TCB *)0) {        /* 上一轮已遍历完毕,从表头开始新的一轮 (see Note #5)      */
+            OSStatTaskTCBCursorPtr = OSTaskDbgListPtr;
+        }
+        p_tcb = OSStatTaskTCBCursorPtr;
         CPU_CRITICAL_EXIT();
-        while (p_tcb != (OS_TCB *)0) {                      /* 开始沿着TCB链表对每一个任务进行遍历                    */
+        while ((p_tcb != (OS_TCB *)0) && (budget > (OS_OBJ_QTY)0)) {
 #if OS_CFG_STAT_TASK_STK_CHK_EN > 0u
             OSTaskStkChk( p_tcb,                            /* Compute stack usage of active tasks only               */
                          &p_tcb->StkFree,
                          &p_tcb->StkUsed,
                          &err);
+#endif
+#if OS_CFG_TASK_PROFILE_EN > 0u
+            CPU_CRITICAL_ENTER();                           /* ------------------ PER-TASK CPU USAGE ---------------- */
+            ts_now                 = OS_TS_GET();
+                                                            /* 距上次处理该任务的时间戳跨度                           */
+            ts_task                = ts_now - p_tcb->CyclesStatTS;
+            p_tcb->CyclesStatTS    = ts_now;
+            p_tcb->CyclesDelta     = (CPU_TS)(p_tcb->CyclesTotal - p_tcb->CyclesTotalPrev);
+            p_tcb->CyclesTotalPrev = p_tcb->CyclesTotal;
+            CPU_CRITICAL_EXIT();
+            usage = 0u;
+            if (ts_task > (CPU_TS)0) {                      /* Usage = CyclesDelta / ts_task, in units of 0.01%       */
+                usage = ((CPU_INT64U)p_tcb->CyclesDelta * 10000u) / ts_task;
+                if (usage > 10000u) {
+                    usage = 10000u;
+                }
+            }
+            p_tcb->CPUUsage = (OS_CPU_USAGE)usage;
+            if (p_tcb->CPUUsageMax < p_tcb->CPUUsage) {
+                p_tcb->CPUUsageMax = p_tcb->CPUUsage;
+            }
 #endif
             CPU_CRITICAL_ENTER();
-            p_tcb->StkPtr = ((struct rt_thread*)p_tcb)->sp; /* 更新SP指针*/
-
-            p_tcb = p_tcb->DbgNextPtr;                      /* 指向下一个TCB结构体                                    */
+            if (OSStatTaskTCBCursorPtr == p_tcb) {          /* 处理期间该任务未被删除                                 */
+                p_tcb->StkPtr = ((struct rt_thread*)p_tcb)->sp; /* 更新SP指针*/
+                OSStatTaskTCBCursorPtr = p_tcb->DbgNextPtr;
+            }
+            p_tcb = OSStatTaskTCBCursorPtr;                 /* 指向下一个TCB结构体                                    */
             CPU_CRITICAL_EXIT();
+            budget--;
         }
 
 #if OS_CFG_TMR_EN > 0u
         /*--------------定时器--------------------*/
         CPU_CRITICAL_ENTER();
-        p_tmr = OSTmrDbgListPtr;
+        budget = (OS_OBJ_QTY)((OSTmrQty + OS_CFG_STAT_TASK_SWEEP_PERIODS - 1u) / OS_CFG_STAT_TASK_SWEEP_PERIODS);
+        if (OSStatTaskTmrCursorPtr == (OS_TMR *)0) {
+            OSStatTaskTmrCursorPtr = OSTmrDbgListPtr;
+        }
         CPU_CRITICAL_EXIT();
-        while(p_tmr != (OS_TMR *)0){
-            CPU_CRITICAL_ENTER();
-            p_tmr->Remain = p_tmr->Tmr.timeout_tick - rt_tick_get();
+        while (budget > (OS_OBJ_QTY)0) {
+            CPU_CRITICAL_ENTER();                           /* 每处理一个定时器开一次中断                             */
+            p_tmr = OSStatTaskTmrCursorPtr;
+            if (p_tmr != (OS_TMR *)0) {
+                p_tmr->Remain = p_tmr->Tmr.timeout_tick - rt_tick_get();
+                OSStatTaskTmrCursorPtr = p_tmr->DbgNextPtr; /*指向下一个定时器控制块*/
+                budget--;
+            } else {
+                budget = (OS_OBJ_QTY)0;                     /* 本轮已遍历完毕                                         */
+            }
             CPU_CRITICAL_EXIT();
-            p_tmr = p_tmr->DbgNextPtr;                      /*指向下一个定时器控制块*/
         }
 #endif
 
@@ -351,6 +477,12 @@ void  OS_StatTaskInit (OS_ERR  *p_err)
     OSStatTaskCtrMax = (OS_TICK)0;
     OSStatTaskRdy    = OS_STATE_NOT_RDY;                    /* Statistic task is not ready                            */
     OSStatResetFlag  = DEF_FALSE;
+#if OS_CFG_DBG_EN > 0u && !defined PKG_USING_UCOSIII_WRAPPER_TINY
+    OSStatTaskTCBCursorPtr = (OS_TCB *)0;                   /* 从表头开始第一轮遍历                                   */
+#if OS_CFG_TMR_EN > 0u
+    OSStatTaskTmrCursorPtr = (OS_TMR *)0;
+#endif
+#endif
 
                                                             /* ---------------- CREATE THE STAT TASK ---------------- */
     if (OSCfg_StatTaskStk == (CPU_STK *)0) {
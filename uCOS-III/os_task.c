@@ -56,6 +56,14 @@
 
 #include "os.h"
 
+#if OS_CFG_STAT_TASK_STK_CHK_EN > 0u
+#if OS_CFG_TASK_STK_CANARY_EN > 0u                          /* 金丝雀所在的字同样视为未使用                             */
+#define  OS_TASK_STK_IS_FILL(stk, fill)  (((stk) == (fill)) || ((stk) == OS_TASK_STK_CANARY))
+#else
+#define  OS_TASK_STK_IS_FILL(stk, fill)  ((stk) == (fill))
+#endif
+#endif
+
 /*
 ************************************************************************************************************************
 * Note(s)    : 1)由于RT-Thread没有相关接口，因此以下函数没有实现
@@ -157,7 +165,8 @@ void  OSTaskChangePrio (OS_TCB   *p_tcb,
 *                             specifying 10% of the 'stk_size' value indicates that the stack limit will be reached
 *                             when the stack reaches 90% full.
 *                            -------------说明-------------
-*                             该参数在本兼容层中没有意义，填什么都行
+*                             OS_CFG_TASK_STK_CANARY_EN使能时,栈金丝雀写在该位置(see Note #1);否则该参数在本兼容层
+*                             中没有意义，填什么都行
 *
 *              stk_size       is the size of the stack in number of elements.  If CPU_STK is set to CPU_INT08U,
 *                             'stk_size' corresponds to the number of bytes available.  If CPU_STK is set to
@@ -166,6 +175,10 @@ void  OSTaskChangePrio (OS_TCB   *p_tcb,
 *                             available on the stack.
 *
 *              q_size         is the maximum number of messages that can be sent to the task
+*                            -------------说明-------------
+*                             q_size > 0时任务内建消息队列在本函数中创建,以保证中断可以随时向任务发送消息;
+*                             任务内建信号量则在首次OSTaskSemPend()时才创建(参见OS_TaskSemCreate()),从而缩短任务
+*                             创建时间
 *
 *              time_quanta    amount of time (in ticks) for time slice when round-robin between tasks.  Specify 0 to use
 *                             the default.
@@ -181,6 +194,7 @@ void  OSTaskChangePrio (OS_TCB   *p_tcb,
 *                                 OS_OPT_TASK_NONE            No option selected
 *                                 OS_OPT_TASK_STK_CHK         Stack checking to be allowed for the task
 *                                 OS_OPT_TASK_STK_CLR         Clear the stack when the task is created
+*                                                             (堆栈总是由rt_thread_init()以'#'填充,该选项无额外开销)
 *                                 OS_OPT_TASK_SAVE_FP         If the CPU has floating-point registers, save them
 *                                                             during a context switch.
 *                                 OS_OPT_TASK_NO_TLS          If the caller doesn't want or need TLS (Thread Local
@@ -214,6 +228,10 @@ void  OSTaskChangePrio (OS_TCB   *p_tcb,
 *                               应用层需要对API返回的错误码判断做出相应的修改
 *
 * Returns    : A pointer to the TCB of the task created.  This pointer must be used as an ID (i.e handle) to the task.
+*
+* Note(s)    : 1) OS_CFG_TASK_STK_CANARY_EN使能时,在StkLimitPtr处写入OS_TASK_STK_CANARY_NBR个金丝雀字(向栈顶方向延伸),
+*                 任务每次被切出时由OSTaskSwHook()检查,被改写即调用OSTaskStkOvfHook().若堆栈过小,金丝雀会覆盖
+*                 rt_thread_init()构造的初始栈帧,此时不设置金丝雀.
 ************************************************************************************************************************
 */
 
@@ -232,7 +250,7 @@ void  OSTaskCreate (OS_TCB        *p_tcb,
                     OS_ERR        *p_err)
 {
     rt_err_t rt_err;
-#if OS_CFG_TASK_SEM_EN > 0u || OS_CFG_TASK_Q_EN > 0u
+#if OS_CFG_TASK_Q_EN > 0u
     OS_ERR err;
 #endif
 #if defined(OS_CFG_TLS_TBL_SIZE) && (OS_CFG_TLS_TBL_SIZE > 0u)
@@ -243,9 +261,12 @@ void  OSTaskCreate (OS_TCB        *p_tcb,
 #endif
 #ifndef PKG_USING_UCOSIII_WRAPPER_TINY
     CPU_STK       *p_stk_limit;
+#endif
+#if OS_CFG_TASK_STK_CANARY_EN > 0u
+    CPU_STK       *p_canary;
+    CPU_STK_SIZE   canary_ix;
 #endif
     CPU_STK       *p_sp;
-    CPU_STK_SIZE   i;
 
     CPU_SR_ALLOC();
 
@@ -314,18 +335,23 @@ void  OSTaskCreate (OS_TCB        *p_tcb,
     }
 #endif
 
-    OS_TaskInitTCB(p_tcb);                                  /* Initialize the TCB to default values                   */
-    *p_err = OS_ERR_NONE;
-                                                            /* --------------- CLEAR THE TASK'S STACK --------------- */
-    if ((opt & OS_OPT_TASK_STK_CHK) != (OS_OPT)0) {         /* See if stack checking has been enabled                 */
-        if ((opt & OS_OPT_TASK_STK_CLR) != (OS_OPT)0) {     /* See if stack needs to be cleared                       */
-            p_sp = p_stk_base;
-            for (i = 0u; i < stk_size; i++) {               /* Stack grows from HIGH to LOW memory                    */
-               *p_sp = (CPU_STK)0;                          /* Clear from bottom of stack and up!                     */
-                p_sp++;
-            }
+#if OS_CFG_ISR_POST_DEFERRED_EN > 0u
+    if (prio == (OS_PRIO)0) {
+        if (p_tcb != &OSIntQTaskTCB) {
+           *p_err = OS_ERR_PRIO_INVALID;                    /* Not allowed to use priority 0                          */
+            return;
         }
     }
+#endif
+
+    OS_TaskInitTCB(p_tcb);                                  /* Initialize the TCB to default values                   */
+    *p_err = OS_ERR_NONE;
+    /*
+        --------------- CLEAR THE TASK'S STACK ---------------
+        OS_OPT_TASK_STK_CLR不再单独清零堆栈:rt_thread_init()总会以'#'填充整个堆栈(rt_memset按字写入),
+        先清零再填充'#'的结果与只填充'#'完全相同.OSTaskStkChk()和RT-Thread的list_thread均以'#'判断堆栈
+        使用量,因此只需这一遍填充.
+    */
 
     p_sp = p_stk_base;
 #if (CPU_CFG_STK_GROWTH == CPU_STK_GROWTH_HI_TO_LO)         /* Check if we overflown the stack during init          */
@@ -343,9 +369,13 @@ void  OSTaskCreate (OS_TCB        *p_tcb,
     CPU_CRITICAL_ENTER();
 #if OS_CFG_TASK_Q_EN > 0u
     p_tcb->MsgCreateSuc = RT_FALSE;
+    p_tcb->MsgQSize = q_size;                               /* 创建失败时可在首次OSTaskQPost/Pend时重试               */
+#else
+    CPU_VAL_UNUSED(q_size);
 #endif
 #if OS_CFG_TASK_SEM_EN > 0u
-    p_tcb->SemCreateSuc = RT_FALSE;
+    p_tcb->SemCreateSuc = RT_FALSE;                         /* 任务内建信号量在首次OSTaskSemPend时才创建              */
+    p_tcb->SemLazyCtr = 0;
 #endif
     p_tcb->ExtPtr = p_ext;                                  /* 用户附加区指针                                         */
     p_tcb->SuspendCtr = 0;                                  /* 嵌套挂起为0层                                          */
@@ -374,9 +404,6 @@ void  OSTaskCreate (OS_TCB        *p_tcb,
         OSQCreate(&p_tcb->MsgQ, (CPU_CHAR*)p_name, q_size, &err);
         if(err != OS_ERR_NONE)                              /* 任务内建消息队列创建失败                               */
         {
-            CPU_CRITICAL_ENTER();
-            p_tcb->MsgCreateSuc = RT_FALSE;
-            CPU_CRITICAL_EXIT();
             RT_DEBUG_LOG(OS_CFG_DBG_EN,("task qmsg %s create err!\n",p_name));
         }
         else
@@ -386,28 +413,10 @@ void  OSTaskCreate (OS_TCB        *p_tcb,
             CPU_CRITICAL_EXIT();
         }
     }
-#else
-    CPU_VAL_UNUSED(q_size);
-#endif
-#if OS_CFG_TASK_SEM_EN > 0u
-    /*创建任务内建信号量*/
-    OSSemCreate(&p_tcb->Sem,(CPU_CHAR*)p_name,0,&err);      /* 任务内建信号量value初始化为0                           */
-    if(err != OS_ERR_NONE)                                  /* 任务内建信号量创建失败                                 */
-    {
-        CPU_CRITICAL_ENTER();
-        p_tcb->SemCreateSuc = RT_FALSE;
-        CPU_CRITICAL_EXIT();
-        RT_DEBUG_LOG(OS_CFG_DBG_EN,("task sem %s create err!\n",p_name));
-    }
-    else
-    {
-        CPU_CRITICAL_ENTER();
-        p_tcb->SemCreateSuc = RT_TRUE;
-        CPU_CRITICAL_EXIT();
-    }
 #endif
+
     CPU_CRITICAL_ENTER();
-#if defined(OS_CFG_TLS_TBL_SIZE) && (OS_CFG_TLS_TBL_SIZE > 0u)/* 线程私有变量暂时没有实现                             */
+#if defined(OS_CFG_TLS_TBL_SIZE) && (OS_CFG_TLS_TBL_SIZE > 0u)
     for (id = 0u; id < OS_CFG_TLS_TBL_SIZE; id++) {
         p_tcb->TLS_Tbl[id] = (OS_TLS)0;
     }
@@ -434,6 +443,30 @@ void  OSTaskCreate (OS_TCB        *p_tcb,
     {
         return;
     }
+    p_tcb->Task.flags |= OS_TASK_FLAG_OS_TCB;               /* 标记该线程为兼容层任务(OS_TCB)                         */
+    OS_TRACE_NAME(p_tcb, p_name);
+
+#if OS_CFG_TASK_STK_CANARY_EN > 0u
+    if ((stk_limit + OS_TASK_STK_CANARY_NBR) < stk_size) {  /* 在StkLimitPtr处写入栈金丝雀 (see Note #1)              */
+#if (CPU_CFG_STK_GROWTH == CPU_STK_GROWTH_HI_TO_LO)
+        p_canary = p_stk_base + stk_limit;
+        if ((p_canary + OS_TASK_STK_CANARY_NBR) > (CPU_STK *)p_tcb->Task.sp) {
+            p_canary = (CPU_STK *)0;                        /* 堆栈过小,金丝雀会覆盖线程的初始栈帧                    */
+        }
+#else
+        p_canary = p_stk_base + (stk_size - stk_limit - OS_TASK_STK_CANARY_NBR);
+        if (p_canary < (CPU_STK *)p_tcb->Task.sp) {
+            p_canary = (CPU_STK *)0;                        /* 堆栈过小,金丝雀会覆盖线程的初始栈帧                    */
+        }
+#endif
+        if (p_canary != (CPU_STK *)0) {
+            for (canary_ix = 0u; canary_ix < OS_TASK_STK_CANARY_NBR; canary_ix++) {
+                p_canary[canary_ix] = OS_TASK_STK_CANARY;
+            }
+            p_tcb->StkCanaryPtr = p_canary;                 /* 线程尚未启动,无需进入临界区                            */
+        }
+    }
+#endif
 
     OSTaskCreateHook(p_tcb);                                /* 调用钩子函数                                           */
 
@@ -463,7 +496,7 @@ void  OSTaskCreate (OS_TCB        *p_tcb,
     p_tcb->TaskEntryArg = p_tcb->Task.parameter;
     p_tcb->Prio = p_tcb->Task.init_priority;
 #if OS_CFG_TASK_SEM_EN > 0u
-    p_tcb->SemCtr = p_tcb->Sem.Sem.value;
+    p_tcb->SemCtr = p_tcb->SemLazyCtr;
 #endif
     CPU_CRITICAL_EXIT();
 #endif
@@ -516,7 +549,7 @@ void  OSTaskDel (OS_TCB  *p_tcb,
 #if OS_CFG_TASK_SEM_EN > 0u || OS_CFG_TASK_Q_EN > 0u
     OS_ERR err;
 #endif
-#ifndef PKG_USING_UCOSIII_WRAPPER_TINY
+#if !defined PKG_USING_UCOSIII_WRAPPER_TINY || ((OS_CFG_MUTEX_EN > 0u) && (OS_CFG_MUTEX_PROFILE_EN > 0u))
     CPU_SR_ALLOC();
 #endif
 
@@ -572,13 +605,38 @@ void  OSTaskDel (OS_TCB  *p_tcb,
 
     rt_err = rt_thread_detach(&p_tcb->Task);
     *p_err = rt_err_to_ucosiii(rt_err);
+#if (OS_CFG_MUTEX_EN > 0u) && (OS_CFG_MUTEX_PROFILE_EN > 0u)
+    CPU_CRITICAL_ENTER();
+    while(p_tcb->MutexHeldPtr != (OS_MUTEX *)0)             /* 被删除的任务仍持有的互斥量结束计时                     */
+    {
+        OS_MutexHeldRemove(p_tcb->MutexHeldPtr);
+    }
+    CPU_CRITICAL_EXIT();
+#endif
+#if (OS_CFG_MUTEX_EN > 0u) && (OS_CFG_MUTEX_CEILING_EN > 0u)
+    CPU_CRITICAL_ENTER();
+    while(p_tcb->CeilingMutexPtr != (OS_MUTEX *)0)          /* 被删除的任务仍持有的天花板互斥量不再指向该任务         */
+    {
+        (void)OS_MutexCeilingRemove(p_tcb->CeilingMutexPtr);
+    }
+    CPU_CRITICAL_EXIT();
+#endif
 #if OS_CFG_TASK_SEM_EN > 0u
-    OSSemDel(&p_tcb->Sem,OS_OPT_DEL_ALWAYS,&err);           /* 删除任务内建信号量                                     */
+    if(p_tcb->SemCreateSuc == RT_TRUE)                      /* 任务内建信号量可能从未被使用过,因此没有创建            */
+    {
+        OSSemDel(&p_tcb->Sem,OS_OPT_DEL_ALWAYS,&err);       /* 删除任务内建信号量                                     */
+    }
 #endif
 #if OS_CFG_TASK_Q_EN > 0u
-    OSQDel(&p_tcb->MsgQ,OS_OPT_DEL_ALWAYS,&err);            /* 删除任务内建消息队列                                   */
+    if(p_tcb->MsgCreateSuc == RT_TRUE)                      /* 任务内建消息队列可能从未被使用过,因此没有创建          */
+    {
+        OSQDel(&p_tcb->MsgQ,OS_OPT_DEL_ALWAYS,&err);        /* 删除任务内建消息队列                                   */
+    }
 #endif
     OSTaskDelHook(p_tcb);                                   /* 调用钩子函数                                           */
+#if defined(OS_CFG_TLS_TBL_SIZE) && (OS_CFG_TLS_TBL_SIZE > 0u)
+    OS_TLS_TaskDel(p_tcb);                                  /* 调用TLS析构函数                                        */
+#endif
     OS_TaskInitTCB(p_tcb);                                  /* Initialize the TCB to default values                   */
     p_tcb->TaskState = (OS_STATE)OS_TASK_STATE_DEL;         /* Indicate that the task was deleted                     */
 
@@ -586,6 +644,270 @@ void  OSTaskDel (OS_TCB  *p_tcb,
 }
 #endif
 
+/*
+************************************************************************************************************************
+*                                                   NOTIFY A TASK
+*
+* Description: This function updates the notification value of a task and readies the task if it is waiting in
+*              OSTaskNotifyWait().  Unlike OSTaskSemPost()/OSTaskQPost() no kernel object is involved: the value lives
+*              in the task's OS_TCB and the (only possible) waiter is resumed directly.
+*
+* Arguments  : p_tcb     is a pointer to the TCB of the task to notify.  A NULL pointer indicates that you are notifying
+*                        yourself.
+*
+*              value     is the value used by the action selected with 'opt'
+*
+*              opt       determines how the notification value is updated:
+*
+*                            OS_OPT_TASK_NOTIFY_NONE          Do not change the notification value
+*                            OS_OPT_TASK_NOTIFY_SET_BITS      OR 'value' into the notification value
+*                            OS_OPT_TASK_NOTIFY_INC           Increment the notification value ('value' is ignored)
+*                            OS_OPT_TASK_NOTIFY_OVERWRITE     Overwrite the notification value with 'value'
+*                            OS_OPT_TASK_NOTIFY_OVERWRITE_NO  Overwrite the notification value with 'value' only if the
+*                                                             task has no notification pending
+*
+*                        OS_OPT_POST_NO_SCHED can be added (or OR'd) with one of the options above.
+*
+*              p_err     is a pointer to an error code returned by this function:
+*
+*                            OS_ERR_NONE                 If the task was notified
+*                            OS_ERR_INT_Q_FULL           If the ISR queue is full (deferred ISR posts only)
+*                            OS_ERR_OPT_INVALID          If you specified an invalid option
+*                            OS_ERR_OS_NOT_RUNNING       If uC/OS-III is not running yet
+*                          + OS_ERR_TASK_NOTIFY_PENDING  OS_OPT_TASK_NOTIFY_OVERWRITE_NO was specified and the task
+*                                                        already has a notification pending
+*                        -------------说明-------------
+*                            OS_ERR_XXXX        表示可以继续沿用uCOS-III原版的错误码
+*                          - OS_ERR_XXXX        表示该错误码在本兼容层已经无法使用
+*                          + OS_ERR_RT_XXXX     表示该错误码为新增的RTT专用错误码集
+*                          应用层需要对API返回的错误码判断做出相应的修改
+*
+* Returns    : none
+*
+* Note(s)    : 1) 该函数为兼容层新增函数,原版uCOS-III没有该函数.可以在中断中调用
+*
+*              2) 使能OS_CFG_ISR_POST_DEFERRED_EN时,在中断中调用只会将通知写入中断队列,由中断处理任务按先后顺序完成,
+*                 此时不会返回OS_ERR_TASK_NOTIFY_PENDING
+************************************************************************************************************************
+*/
+
+#if OS_CFG_TASK_NOTIFY_EN > 0u
+void  OSTaskNotify (OS_TCB         *p_tcb,
+                    OS_NOTIFY_VAL   value,
+                    OS_OPT          opt,
+                    OS_ERR         *p_err)
+{
+    OS_STATE  state;
+
+    CPU_SR_ALLOC();
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                 /* Is the kernel running?                                 */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return;
+    }
+#endif
+
+#if OS_CFG_ARG_CHK_EN > 0u
+    switch (opt & ~OS_OPT_POST_NO_SCHED) {                  /* Validate 'opt'                                         */
+        case OS_OPT_TASK_NOTIFY_NONE:
+        case OS_OPT_TASK_NOTIFY_SET_BITS:
+        case OS_OPT_TASK_NOTIFY_INC:
+        case OS_OPT_TASK_NOTIFY_OVERWRITE:
+        case OS_OPT_TASK_NOTIFY_OVERWRITE_NO:
+             break;
+
+        default:
+            *p_err = OS_ERR_OPT_INVALID;
+             return;
+    }
+#endif
+
+    if(p_tcb == RT_NULL)
+    {
+        p_tcb = OSTCBCurPtr;
+    }
+
+#if OS_CFG_ISR_POST_DEFERRED_EN > 0u
+    if (OSIntNestingCtr > (OS_NESTING_CTR)0) {              /* See if called from an ISR (see Note #2)                */
+        OS_IntQPost((OS_OBJ_TYPE)OS_OBJ_TYPE_TASK_NOTIFY,   /* Post to ISR queue                                      */
+                    (void      *)p_tcb,
+                    (void      *)0,
+                    (OS_MSG_SIZE)0,
+                    (OS_FLAGS   )value,
+                    (OS_PRIO    )0,
+                    (OS_OPT     )opt,
+                    (CPU_TS     )OS_TS_GET(),
+                    (OS_ERR    *)p_err);
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    state = p_tcb->NotifyState;
+    switch (opt & ~OS_OPT_POST_NO_SCHED) {
+        case OS_OPT_TASK_NOTIFY_SET_BITS:
+             p_tcb->NotifyVal |= value;
+             break;
+
+        case OS_OPT_TASK_NOTIFY_INC:
+             p_tcb->NotifyVal++;
+             break;
+
+        case OS_OPT_TASK_NOTIFY_OVERWRITE_NO:
+             if (state == OS_TASK_NOTIFY_PENDING) {         /* 上一个通知尚未被处理,不能覆盖                         */
+                 CPU_CRITICAL_EXIT();
+                *p_err = OS_ERR_TASK_NOTIFY_PENDING;
+                 return;
+             }
+             p_tcb->NotifyVal = value;
+             break;
+
+        case OS_OPT_TASK_NOTIFY_OVERWRITE:
+             p_tcb->NotifyVal = value;
+             break;
+
+        case OS_OPT_TASK_NOTIFY_NONE:
+        default:
+             break;
+    }
+    p_tcb->NotifyState = OS_TASK_NOTIFY_PENDING;
+
+    if (state != OS_TASK_NOTIFY_WAITING) {                  /* 任务没有在等待通知,记录下来即可                        */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_NONE;
+        return;
+    }
+    rt_thread_resume(&p_tcb->Task);                         /* 直接唤醒唯一的等待者(会同时停止其超时定时器)          */
+    CPU_CRITICAL_EXIT();
+
+   *p_err = OS_ERR_NONE;
+    if ((opt & OS_OPT_POST_NO_SCHED) == (OS_OPT)0) {
+        rt_schedule();
+    }
+}
+#endif
+
+/*
+************************************************************************************************************************
+*                                              WAIT FOR A TASK NOTIFICATION
+*
+* Description: This function causes the current task to wait for a notification sent with OSTaskNotify().
+*
+* Arguments  : clear_on_entry  are the bits of the notification value to clear before waiting.  The bits are only
+*                              cleared if no notification is already pending.
+*
+*              clear_on_exit   are the bits of the notification value to clear after a notification was received
+*                              (specify 0xFFFFFFFF to reset the value to 0).
+*
+*              p_value         is a pointer to a variable that will receive the notification value (before
+*                              'clear_on_exit' is applied).  A NULL pointer can be specified if the value is not needed.
+*
+*              timeout         is an optional timeout period (in clock ticks).  If non-zero, your task will wait for a
+*                              notification up to the amount of time specified by this argument.  If you specify 0,
+*                              however, your task will wait forever or, until a notification is received.
+*
+*              p_err           is a pointer to an error code returned by this function:
+*
+*                                  OS_ERR_NONE            A notification was received
+*                                  OS_ERR_OS_NOT_RUNNING  If uC/OS-III is not running yet
+*                                  OS_ERR_PEND_ISR        If you called this function from an ISR
+*                                  OS_ERR_SCHED_LOCKED    If the scheduler is locked
+*                                  OS_ERR_TIMEOUT         A notification was not received within the specified timeout
+*
+* Returns    : none
+*
+* Note(s)    : 1) 该函数为兼容层新增函数,原版uCOS-III没有该函数
+*              2) 等待者只可能是任务自己,因此不需要任何内核对象的等待链表,直接挂起当前线程并启动其自带的超时定时器
+*                 (参见rt_thread_sleep()),由OSTaskNotify()调用rt_thread_resume()唤醒
+************************************************************************************************************************
+*/
+
+#if OS_CFG_TASK_NOTIFY_EN > 0u
+void  OSTaskNotifyWait (OS_NOTIFY_VAL   clear_on_entry,
+                        OS_NOTIFY_VAL   clear_on_exit,
+                        OS_NOTIFY_VAL  *p_value,
+                        OS_TICK         timeout,
+                        OS_ERR         *p_err)
+{
+    OS_TCB    *p_tcb;
+    rt_tick_t  time;
+
+    CPU_SR_ALLOC();
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u
+    if(OSIntNestingCtr > (OS_NESTING_CTR)0)                 /* 检查是否在中断中运行                                   */
+    {
+        *p_err = OS_ERR_PEND_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                 /* Is the kernel running?                                 */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return;
+    }
+#endif
+
+    p_tcb = OSTCBCurPtr;
+
+    CPU_CRITICAL_ENTER();
+    if (p_tcb->NotifyState != OS_TASK_NOTIFY_PENDING) {     /* 尚未收到通知,需要等待                                  */
+        if (OSSchedLockNestingCtr > (OS_NESTING_CTR)0) {    /* 检查调度器是否被锁                                     */
+            CPU_CRITICAL_EXIT();
+           *p_err = OS_ERR_SCHED_LOCKED;
+            return;
+        }
+        p_tcb->NotifyVal   &= ~clear_on_entry;
+        p_tcb->NotifyState  = OS_TASK_NOTIFY_WAITING;
+        p_tcb->PendStatus   = OS_STATUS_PEND_OK;
+        p_tcb->TaskState   |= OS_TASK_STATE_PEND;
+        p_tcb->PendOn       = OS_TASK_PEND_ON_TASK_NOTIFY;
+
+        rt_thread_suspend(&p_tcb->Task);                    /* 挂起当前线程                                           */
+        if (timeout > (OS_TICK)0) {                         /* 在uCOS-III中timeout=0表示永久阻塞                      */
+            time = timeout;
+            rt_timer_control(&p_tcb->Task.thread_timer, RT_TIMER_CTRL_SET_TIME, &time);
+            rt_timer_start(&p_tcb->Task.thread_timer);
+        }
+        CPU_CRITICAL_EXIT();
+
+        rt_schedule();                                      /* 等待OSTaskNotify()或超时将本任务唤醒                   */
+
+        CPU_CRITICAL_ENTER();
+        p_tcb->TaskState &= ~OS_TASK_STATE_PEND;            /* 更新任务状态                                           */
+        p_tcb->PendOn     = OS_TASK_PEND_ON_NOTHING;        /* 清除当前任务等待状态                                   */
+    }
+
+    if (p_value != (OS_NOTIFY_VAL *)0) {
+       *p_value = p_tcb->NotifyVal;
+    }
+    if (p_tcb->NotifyState == OS_TASK_NOTIFY_PENDING) {
+        p_tcb->NotifyVal &= ~clear_on_exit;
+       *p_err = OS_ERR_NONE;
+    } else {
+       *p_err = OS_ERR_TIMEOUT;
+    }
+    p_tcb->NotifyState = OS_TASK_NOTIFY_NONE;
+    CPU_CRITICAL_EXIT();
+}
+#endif
+
 /*
 ************************************************************************************************************************
 *                                                    FLUSH TASK's QUEUE
@@ -643,6 +965,12 @@ OS_MSG_QTY  OSTaskQFlush (OS_TCB  *p_tcb,
         CPU_CRITICAL_EXIT();
     }
 
+    if(p_tcb->MsgCreateSuc != RT_TRUE)                      /* 任务内建消息队列尚未创建,没有消息可以清除              */
+    {
+        *p_err = OS_ERR_NONE;
+        return ((OS_MSG_QTY)0);
+    }
+
     return OSQFlush(&p_tcb->MsgQ, p_err);
 }
 #endif
@@ -712,16 +1040,14 @@ void  *OSTaskQPend (OS_TICK       timeout,
 
     p_tcb = OSTCBCurPtr;
 
-    if(p_tcb->MsgCreateSuc == RT_TRUE)                      /* 检查任务内建消息队列是否创建成功                       */
-    {
-        p_tcb->PendOn = OS_TASK_PEND_ON_TASK_Q;
-        return OSQPend(&p_tcb->MsgQ,timeout,opt,p_msg_size,p_ts,p_err);
-    }
-    else
+    OS_TaskQCreate(p_tcb, p_err);                           /* 首次使用时创建任务内建消息队列                         */
+    if(*p_err != OS_ERR_NONE)
     {
-        *p_err = OS_ERR_TASK_Q_CREATE_FALSE;
         return RT_NULL;
     }
+
+    p_tcb->PendOn = OS_TASK_PEND_ON_TASK_Q;
+    return OSQPend(&p_tcb->MsgQ,timeout,opt,p_msg_size,p_ts,p_err);
 }
 #endif
 
@@ -878,14 +1204,13 @@ void  OSTaskQPost (OS_TCB       *p_tcb,
         p_tcb = OSTCBCurPtr;
     }
 
-    if(p_tcb->MsgCreateSuc == RT_TRUE)                      /* 检查任务内建消息队列是否创建成功                       */
-    {
-        OSQPost(&p_tcb->MsgQ,p_void,msg_size,opt,p_err);
-    }
-    else
+    OS_TaskQCreate(p_tcb, p_err);                           /* 首次使用时创建任务内建消息队列                         */
+    if(*p_err != OS_ERR_NONE)
     {
-        *p_err = OS_ERR_TASK_Q_CREATE_FALSE;
+        return;
     }
+
+    OSQPost(&p_tcb->MsgQ,p_void,msg_size,opt,p_err);
 }
 #endif
 
@@ -1212,29 +1537,27 @@ OS_SEM_CTR  OSTaskSemPend (OS_TICK   timeout,
 #endif
 
     p_tcb = OSTCBCurPtr;
-    if(p_tcb->SemCreateSuc == RT_TRUE)                            /* 检查任务内建信号量是否创建成功                   */
+    OS_TaskSemCreate(p_tcb, p_err);                               /* 首次使用时创建任务内建信号量                     */
+    if(*p_err != OS_ERR_NONE)
     {
-        CPU_CRITICAL_ENTER();
-        p_tcb->PendOn = OS_TASK_PEND_ON_TASK_SEM;                 /* 设置任务等待状态                                 */
+        return 0;
+    }
+
+    CPU_CRITICAL_ENTER();
+    p_tcb->PendOn = OS_TASK_PEND_ON_TASK_SEM;                     /* 设置任务等待状态                                 */
 #ifndef PKG_USING_UCOSIII_WRAPPER_TINY
-        p_tcb->SemCtr = p_tcb->Sem.Sem.value;                     /* 更新value                                        */
+    p_tcb->SemCtr = p_tcb->Sem.Sem.value;                         /* 更新value                                        */
 #endif
-        CPU_CRITICAL_EXIT();
+    CPU_CRITICAL_EXIT();
 
-        ctr = OSSemPend(&p_tcb->Sem,timeout,opt,p_ts,p_err);
+    ctr = OSSemPend(&p_tcb->Sem,timeout,opt,p_ts,p_err);
 
-        CPU_CRITICAL_ENTER();
+    CPU_CRITICAL_ENTER();
 #ifndef PKG_USING_UCOSIII_WRAPPER_TINY
-        p_tcb->SemCtr = p_tcb->Sem.Sem.value;                     /* 更新value                                        */
+    p_tcb->SemCtr = p_tcb->Sem.Sem.value;                         /* 更新value                                        */
 #endif
-        CPU_CRITICAL_EXIT();
-        return ctr;
-    }
-    else
-    {
-        *p_err = OS_ERR_TASK_SEM_CREATE_FALSE;
-        return 0;
-    }
+    CPU_CRITICAL_EXIT();
+    return ctr;
 }
 #endif
 
@@ -1357,7 +1680,6 @@ CPU_BOOLEAN  OSTaskSemPendAbort (OS_TCB  *p_tcb,
 *                            OS_ERR_NONE              If the requested task is signaled
 *                            OS_ERR_OS_NOT_RUNNING    If uC/OS-III is not running yet
 *                            OS_ERR_SEM_OVF           If the post would cause the semaphore count to overflow.
-*                          + OS_ERR_TASK_SEM_CREATE_FALSE 任务内建信号量创建失败
 *                        -------------说明-------------
 *                            OS_ERR_XXXX        表示可以继续沿用uCOS-III原版的错误码
 *                          - OS_ERR_XXXX        表示该错误码在本兼容层已经无法使用
@@ -1388,21 +1710,37 @@ OS_SEM_CTR  OSTaskSemPost (OS_TCB  *p_tcb,
     {
         p_tcb = OSTCBCurPtr;
     }
-    if(p_tcb->SemCreateSuc == RT_TRUE)                      /* 检查任务内建信号量是否创建成功                         */
+
+    CPU_CRITICAL_ENTER();
+    if(p_tcb->SemCreateSuc != RT_TRUE)                      /* 任务内建信号量尚未创建,说明任务还没有等待过信号        */
     {
-        ctr = OSSemPost(&p_tcb->Sem,opt,p_err);
-        CPU_CRITICAL_ENTER();
+        if(p_tcb->SemLazyCtr == (OS_SEM_CTR)RT_UINT16_MAX)  /* rt_semaphore.value为16位                               */
+        {
+            CPU_CRITICAL_EXIT();
+            *p_err = OS_ERR_SEM_OVF;
+            return 0;
+        }
+        p_tcb->SemLazyCtr++;                                /* 先累计信号,待信号量创建时作为其初始值                  */
+        ctr = p_tcb->SemLazyCtr;
+#if OS_CFG_TS_EN > 0u
+        p_tcb->SemLazyTS = OS_PostTS();                     /* 记录最近一次发布的时间戳,待信号量创建时继承            */
+#endif
 #ifndef PKG_USING_UCOSIII_WRAPPER_TINY
-        p_tcb->SemCtr = p_tcb->Sem.Sem.value;
+        p_tcb->SemCtr = ctr;
 #endif
         CPU_CRITICAL_EXIT();
+        *p_err = OS_ERR_NONE;
         return ctr;
     }
-    else
-    {
-        *p_err = OS_ERR_TASK_SEM_CREATE_FALSE;
-        return 0;
-    }
+    CPU_CRITICAL_EXIT();
+
+    ctr = OSSemPost(&p_tcb->Sem,opt,p_err);
+    CPU_CRITICAL_ENTER();
+#ifndef PKG_USING_UCOSIII_WRAPPER_TINY
+    p_tcb->SemCtr = p_tcb->Sem.Sem.value;
+#endif
+    CPU_CRITICAL_EXIT();
+    return ctr;
 }
 #endif
 
@@ -1455,10 +1793,18 @@ OS_SEM_CTR  OSTaskSemSet (OS_TCB      *p_tcb,
     }
 
     CPU_CRITICAL_ENTER();
-    ctr = p_tcb->Sem.Sem.value;
-    p_tcb->Sem.Sem.value = (OS_SEM_CTR)cnt;                 /* 设置RTT信号量value                                     */
+    if(p_tcb->SemCreateSuc == RT_TRUE)
+    {
+        ctr = p_tcb->Sem.Sem.value;
+        p_tcb->Sem.Sem.value = (OS_SEM_CTR)cnt;             /* 设置RTT信号量value                                     */
+    }
+    else
+    {
+        ctr = p_tcb->SemLazyCtr;                            /* 任务内建信号量尚未创建,设置其创建时的初始值            */
+        p_tcb->SemLazyCtr = cnt;
+    }
 #ifndef PKG_USING_UCOSIII_WRAPPER_TINY
-    p_tcb->SemCtr = p_tcb->Sem.Sem.value;                   /* 更新.SemCtr                                            */
+    p_tcb->SemCtr = (OS_SEM_CTR)cnt;                        /* 更新.SemCtr                                            */
 #endif
     CPU_CRITICAL_EXIT();
     *p_err = OS_ERR_NONE;
@@ -1500,6 +1846,10 @@ OS_SEM_CTR  OSTaskSemSet (OS_TCB      *p_tcb,
 *
 * Note(s)    : 1) 原版函数获取的是实时堆栈使用情况,在本兼容层中该函数获取到的截止到当前时刻的堆栈最大使用和实时使用/剩余,
 *                 比原版函数多了一个p_used_max参数,这要比原版更能有效的评估当前任务(线程)的堆栈使用情况
+*
+*              2) RT-Thread在创建线程时将堆栈填充为'#',本函数以CPU_STK为单位比较填充值,从栈末端开始查找第一个被
+*                 改写的CPU_STK,只在该字中逐字节比较.每次检查都从栈末端重新查找,因此即使局部变量在栈上留下了未写入
+*                 的区域,得到的最大使用量也是准确的.
 ************************************************************************************************************************
 */
 
@@ -1514,6 +1864,10 @@ void  OSTaskStkChk (OS_TCB        *p_tcb,
     rt_uint32_t stack_free;
     rt_uint8_t *ptr;
     rt_thread_t thread;
+    CPU_STK *p_stk;
+    CPU_STK fill;
+    CPU_STK_SIZE nbr;
+    CPU_STK_SIZE i;
 
     CPU_SR_ALLOC();
 
@@ -1576,23 +1930,34 @@ void  OSTaskStkChk (OS_TCB        *p_tcb,
     *p_err = OS_ERR_NONE;
 
     /*计算RT-Thread堆栈最大使用情况*/
-#if CPU_CFG_STK_GROWTH == CPU_STK_GROWTH_HI_TO_LO
-    ptr = (rt_uint8_t *)thread->stack_addr;
-    while (*ptr == '#')ptr ++;
+    /*RT-Thread创建线程时以'#'填充堆栈,构造每个字节均为'#'的CPU_STK*/
+    fill = (CPU_STK)(((CPU_STK)~(CPU_STK)0 / (CPU_STK)0xFFu) * (CPU_STK)'#');
+    p_stk = (CPU_STK *)thread->stack_addr;
     stack_size = thread->stack_size;
-    stack_used = thread->stack_size - ((rt_ubase_t) ptr - (rt_ubase_t) thread->stack_addr);
-    stack_free = stack_size - stack_used;
-    *p_used = stack_used / sizeof(CPU_STK_SIZE);
-    *p_free = stack_free / sizeof(CPU_STK_SIZE);
+    nbr = (CPU_STK_SIZE)(stack_size / sizeof(CPU_STK));
+    i = 0u;
+#if CPU_CFG_STK_GROWTH == CPU_STK_GROWTH_HI_TO_LO
+    while ((i < nbr) && OS_TASK_STK_IS_FILL(p_stk[i], fill)) {
+        i++;                                                /* 从栈底(低地址)向上查找 (see Note #2)                   */
+    }
+    ptr = (rt_uint8_t *)&p_stk[i];                          /* 高水位所在的字中可能还有未使用的字节                   */
+    while (((rt_ubase_t)ptr < (rt_ubase_t)thread->stack_addr + stack_size) && (*ptr == '#')) {
+        ptr++;
+    }
+    stack_free = (rt_ubase_t)ptr - (rt_ubase_t)thread->stack_addr;
 #else
-    ptr = (rt_uint8_t *)thread->stack_addr + thread->stack_size - 1;
-    while (*ptr == '#')ptr --;
-    stack_size = thread->stack_size;
-    stack_used = (rt_ubase_t)ptr - (rt_ubase_t)thread->stack_addr
-    stack_free = stack_size - stack_used;
+    while ((i < nbr) && OS_TASK_STK_IS_FILL(p_stk[nbr - 1u - i], fill)) {
+        i++;                                                /* 从栈顶(高地址)向下查找 (see Note #2)                   */
+    }
+    ptr = (rt_uint8_t *)&p_stk[nbr - i];                    /* 高水位所在的字中可能还有未使用的字节                   */
+    while (((rt_ubase_t)ptr > (rt_ubase_t)thread->stack_addr) && (*(ptr - 1) == '#')) {
+        ptr--;
+    }
+    stack_free = (rt_ubase_t)thread->stack_addr + stack_size - (rt_ubase_t)ptr;
+#endif
+    stack_used = stack_size - stack_free;
     *p_used = stack_used / sizeof(CPU_STK_SIZE);
     *p_free = stack_free / sizeof(CPU_STK_SIZE);
-#endif
 }
 #endif
 
@@ -1730,6 +2095,144 @@ void   OSTaskSuspend (OS_TCB  *p_tcb,
 //}
 #endif
 
+/*
+************************************************************************************************************************
+*                                       CREATE THE TASK'S BUILT-IN SEMAPHORE ON DEMAND
+*
+* Description: This function is called by OSTaskSemPend() to create the task's built-in semaphore the first time the
+*              task waits for a signal.
+*
+* Arguments  : p_tcb     is a pointer to the OS_TCB of the calling task
+*
+*              p_err     is a pointer to a variable that will contain an error code returned by this function.
+*
+*                            OS_ERR_NONE                   the semaphore exists (or was just created)
+*                            OS_ERR_TASK_SEM_CREATE_FALSE  the semaphore could not be created
+*
+* Returns    : none
+*
+* Note(s)    : 1) 只有任务自己会等待其内建信号量,因此信号量仅由任务自己创建,不存在多个任务同时创建的情况.
+*                 在此之前调用OSTaskSemPost()/OSTaskSemSet()(包括在中断中调用)所产生的信号累计在.SemLazyCtr中,
+*                 创建时作为信号量的初始值
+*              2) This function is INTERNAL to uC/OS-III and your application should not call it.
+************************************************************************************************************************
+*/
+
+#if OS_CFG_TASK_SEM_EN > 0u
+void  OS_TaskSemCreate (OS_TCB  *p_tcb,
+                        OS_ERR  *p_err)
+{
+    CPU_SR_ALLOC();
+
+    if(p_tcb->SemCreateSuc == RT_TRUE)                      /* 已经创建过                                             */
+    {
+        *p_err = OS_ERR_NONE;
+        return;
+    }
+
+    OSSemCreate(&p_tcb->Sem,(CPU_CHAR*)p_tcb->Task.name,0,p_err);
+    if(*p_err != OS_ERR_NONE)                               /* 任务内建信号量创建失败                                 */
+    {
+        RT_DEBUG_LOG(OS_CFG_DBG_EN,("task sem %s create err!\n",p_tcb->Task.name));
+        *p_err = OS_ERR_TASK_SEM_CREATE_FALSE;
+        return;
+    }
+
+    CPU_CRITICAL_ENTER();
+    p_tcb->Sem.Sem.value = (rt_uint16_t)p_tcb->SemLazyCtr;  /* 继承创建前累计的信号                                   */
+    p_tcb->SemLazyCtr = 0;
+#if OS_CFG_TS_EN > 0u
+    p_tcb->Sem.TS = p_tcb->SemLazyTS;
+#endif
+#ifndef PKG_USING_UCOSIII_WRAPPER_TINY
+    p_tcb->Sem.Ctr = p_tcb->Sem.Sem.value;
+#endif
+    p_tcb->SemCreateSuc = RT_TRUE;
+    CPU_CRITICAL_EXIT();
+}
+#endif
+
+/*
+************************************************************************************************************************
+*                                    CREATE THE TASK'S BUILT-IN MESSAGE QUEUE ON DEMAND
+*
+* Description: OSTaskCreate() creates the task's built-in message queue up front.  If that failed (e.g. the heap was
+*              exhausted), this function is called by OSTaskQPost() and OSTaskQPend() to retry the creation.
+*
+* Arguments  : p_tcb     is a pointer to the OS_TCB of the task owning the message queue
+*
+*              p_err     is a pointer to a variable that will contain an error code returned by this function.
+*
+*                            OS_ERR_NONE                   the message queue exists (or was just created)
+*                            OS_ERR_TASK_Q_CREATE_FALSE    the task was created with 'q_size' == 0, the message queue
+*                                                          could not be allocated, or it does not exist yet and the
+*                                                          caller is an ISR
+*
+* Returns    : none
+*
+* Note(s)    : 1) 消息队列存储区需要从堆中分配,因此不能在中断中重试创建
+*              2) 存储区在锁调度器之前分配;锁调度器之后再次检查是否已被其他任务抢先创建,若是则释放存储区
+*              3) This function is INTERNAL to uC/OS-III and your application should not call it.
+************************************************************************************************************************
+*/
+
+#if OS_CFG_TASK_Q_EN > 0u
+void  OS_TaskQCreate (OS_TCB  *p_tcb,
+                      OS_ERR  *p_err)
+{
+    void        *p_pool;
+    OS_MSG_QTY   q_size;
+
+    CPU_SR_ALLOC();
+
+    if(p_tcb->MsgCreateSuc == RT_TRUE)                      /* 已经创建过                                             */
+    {
+        *p_err = OS_ERR_NONE;
+        return;
+    }
+
+    q_size = p_tcb->MsgQSize;
+    if(q_size == 0 || OSIntNestingCtr > (OS_NESTING_CTR)0)  /* 未开启任务内建消息队列或者在中断中                     */
+    {
+        *p_err = OS_ERR_TASK_Q_CREATE_FALSE;
+        return;
+    }
+
+    p_pool = RT_KERNEL_MALLOC(OS_Q_STORAGE_SIZE(q_size));   /* 分配用于存放消息的缓冲区                               */
+    if(p_pool == RT_NULL)
+    {
+        RT_DEBUG_LOG(OS_CFG_DBG_EN,("task qmsg %s create err!\n",p_tcb->Task.name));
+        *p_err = OS_ERR_TASK_Q_CREATE_FALSE;
+        return;
+    }
+
+    rt_enter_critical();                                    /* 防止多个任务同时创建                                   */
+    if(p_tcb->MsgCreateSuc == RT_TRUE)                      /* 已被其他任务抢先创建                                   */
+    {
+        rt_exit_critical();
+        RT_KERNEL_FREE(p_pool);
+        *p_err = OS_ERR_NONE;
+        return;
+    }
+    OSQCreateStatic(&p_tcb->MsgQ, (CPU_CHAR*)p_tcb->Task.name, p_pool, q_size, p_err);
+    if(*p_err == OS_ERR_NONE)
+    {
+        CPU_CRITICAL_ENTER();
+        p_tcb->MsgQ.p_pool = p_pool;                        /* 由OSQDel()负责释放                                     */
+        p_tcb->MsgCreateSuc = RT_TRUE;
+        CPU_CRITICAL_EXIT();
+    }
+    rt_exit_critical();
+
+    if(*p_err != OS_ERR_NONE)                               /* 任务内建消息队列创建失败                               */
+    {
+        RT_KERNEL_FREE(p_pool);
+        RT_DEBUG_LOG(OS_CFG_DBG_EN,("task qmsg %s create err!\n",p_tcb->Task.name));
+        *p_err = OS_ERR_TASK_Q_CREATE_FALSE;
+    }
+}
+#endif
+
 /*
 ************************************************************************************************************************
 *                                            ADD/REMOVE TASK TO/FROM DEBUG LIST
@@ -1768,6 +2271,12 @@ void  OS_TaskDbgListRemove (OS_TCB  *p_tcb)
     p_tcb_prev = p_tcb->DbgPrevPtr;
     p_tcb_next = p_tcb->DbgNextPtr;
 
+#if OS_CFG_STAT_TASK_EN > 0u
+    if (OSStatTaskTCBCursorPtr == p_tcb) {                  /* 统计任务的遍历游标跳过被删除的任务                     */
+        OSStatTaskTCBCursorPtr = p_tcb_next;
+    }
+#endif
+
     if (p_tcb_prev == (OS_TCB *)0) {
         OSTaskDbgListPtr = p_tcb_next;
         if (p_tcb_next != (OS_TCB *)0) {
@@ -1847,15 +2356,45 @@ void  OS_TaskInitTCB (OS_TCB  *p_tcb)
     CPU_SR_ALLOC();
 
     CPU_CRITICAL_ENTER();
+    p_tcb->Task.flags        &= (rt_uint8_t     )~OS_TASK_FLAG_OS_TCB;
 #if OS_CFG_TASK_SEM_EN > 0u
     p_tcb->SemCreateSuc       = (CPU_BOOLEAN    )RT_FALSE;
+    p_tcb->SemLazyCtr         = (OS_SEM_CTR     )0u;
+#if OS_CFG_TS_EN > 0u
+    p_tcb->SemLazyTS          = (CPU_TS         )0u;
+#endif
 #endif
 #if OS_CFG_TASK_Q_EN > 0u
     p_tcb->MsgPtr             = (void          *)0u;
     p_tcb->MsgSize            = (OS_MSG_SIZE    )0u;
     p_tcb->MsgCreateSuc       = (CPU_BOOLEAN    )RT_FALSE;
+    p_tcb->MsgQSize           = (OS_MSG_QTY     )0u;
+#endif
+#if OS_CFG_TASK_NOTIFY_EN > 0u
+    p_tcb->NotifyVal          = (OS_NOTIFY_VAL  )0u;
+    p_tcb->NotifyState        = (OS_STATE       )OS_TASK_NOTIFY_NONE;
 #endif
     p_tcb->ExtPtr             = (void          *)0u;
+#if OS_CFG_TASK_PROFILE_EN > 0u
+    p_tcb->CtxSwCtr           = (OS_CTR         )0u;
+    p_tcb->CyclesDelta        = (CPU_TS         )0u;
+    p_tcb->CyclesStart        = (CPU_TS         )0u;
+    p_tcb->CyclesTotal        = (OS_CYCLES      )0u;
+    p_tcb->CyclesTotalPrev    = (OS_CYCLES      )0u;
+    p_tcb->CyclesStatTS       = (CPU_TS         )OS_TS_GET();
+    p_tcb->CPUUsage           = (OS_CPU_USAGE   )0u;
+    p_tcb->CPUUsageMax        = (OS_CPU_USAGE   )0u;
+#endif
+#ifdef CPU_CFG_INT_DIS_MEAS_EN
+    p_tcb->IntDisTimeMax      = (CPU_TS         )0u;
+#endif
+#if (OS_CFG_MUTEX_EN > 0u) && (OS_CFG_MUTEX_PROFILE_EN > 0u)
+    p_tcb->MutexHeldPtr       = (OS_MUTEX      *)0;
+#endif
+#if (OS_CFG_MUTEX_EN > 0u) && (OS_CFG_MUTEX_CEILING_EN > 0u)
+    p_tcb->CeilingMutexPtr    = (OS_MUTEX      *)0;
+    p_tcb->CeilingBasePrio    = (OS_PRIO        )OS_PRIO_INIT;
+#endif
 #if OS_CFG_TASK_REG_TBL_SIZE > 0u
     for (reg_id = 0u; reg_id < OS_CFG_TASK_REG_TBL_SIZE; reg_id++) {
         p_tcb->RegTbl[reg_id] = (OS_REG)0u;
@@ -1868,6 +2407,9 @@ void  OS_TaskInitTCB (OS_TCB  *p_tcb)
 #if OS_CFG_STAT_TASK_STK_CHK_EN > 0u
     p_tcb->StkFree            = (CPU_STK_SIZE   )0u;
     p_tcb->StkUsed            = (CPU_STK_SIZE   )0u;
+#endif
+#if OS_CFG_TASK_STK_CANARY_EN > 0u
+    p_tcb->StkCanaryPtr       = (CPU_STK       *)0;
 #endif
     p_tcb->TaskState          = (OS_STATE       )OS_TASK_STATE_RDY;
     p_tcb->PendOn             = (OS_STATE       )OS_TASK_PEND_ON_NOTHING;
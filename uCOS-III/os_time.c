@@ -164,6 +164,7 @@ void  OSTimeDly (OS_TICK   dly,
     OSTCBCurPtr->TaskState |= OS_TASK_STATE_DLY;
     CPU_CRITICAL_EXIT();
 
+    OS_TRACE(OS_TRACE_EV_TIME_DLY, 0, dly);
     if(opt == OS_OPT_TIME_MATCH)
     {
         rt_err = rt_thread_delay(dly - rt_tick_get());
@@ -174,6 +175,7 @@ void  OSTimeDly (OS_TICK   dly,
     }
 
     *p_err = rt_err_to_ucosiii(rt_err);
+    OS_TRACE(OS_TRACE_EV_TIME_DLY_EXIT, 0, *p_err);
 
     CPU_CRITICAL_ENTER();
     OSTCBCurPtr->TaskState &= ~OS_TASK_STATE_DLY;
@@ -0,0 +1,440 @@
+/*
+ * Copyright (c) 2021, Meco Jianting Man <jiantingman@foxmail.com>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2026-10-19     agent        implement task local storage
+ */
+/*
+************************************************************************************************************************
+*                                                      uC/OS-III
+*                                                 The Real-Time Kernel
+*
+*                                            TASK LOCAL STORAGE MANAGEMENT
+*
+* File    : OS_TLS.C
+* Version : V3.03.00
+************************************************************************************************************************
+* Note(s)    : 1) 每个任务的OS_TCB中有OS_CFG_TLS_TBL_SIZE个TLS槽(.TLS_Tbl[]),TLS ID即槽的下标,由OS_TLS_GetID()分配,
+*                 分配后不可释放.读写均为一次数组访问.
+*
+*              2) 当前任务的TLS槽只会被任务自身访问,因此OS_TLS_GetValue()/OS_TLS_SetValue()在'p_tcb'为NULL时不进入
+*                 临界区;访问其他任务的TLS槽时仍然进入临界区.
+*
+*              3) 只有由OSTaskCreate()创建(且没有指定OS_OPT_TASK_NO_TLS)的任务才有TLS槽,在RT-Thread原生线程中调用
+*                 将返回OS_ERR_TLS_NOT_EN.
+*
+*              4) 通过OSTaskDel()删除任务时,对每个已分配的ID调用OS_TLS_SetDestruct()设置的析构函数.任务从入口函数
+*                 返回而由RT-Thread自动删除时,不会调用析构函数.
+************************************************************************************************************************
+*/
+
+#include "os.h"
+
+#if defined(OS_CFG_TLS_TBL_SIZE) && (OS_CFG_TLS_TBL_SIZE > 0u)
+static  CPU_BOOLEAN  OS_TLS_TaskIsEn (OS_TCB  *p_tcb);
+
+/*
+************************************************************************************************************************
+*                                              ALLOCATE THE NEXT AVAILABLE TLS ID
+*
+* Description: This function is called to obtain the ID of the next free TLS (Task Local Storage) register 'id'
+*
+* Arguments  : p_err       is a pointer to a variable that will hold an error code related to this call.
+*
+*                            OS_ERR_NONE               if the call was successful
+*                            OS_ERR_TLS_ISR            if you called this function from an ISR
+*                            OS_ERR_TLS_NO_MORE_AVAIL  if you are attempting to assign more TLS than you declared
+*                                                           available through OS_CFG_TLS_TBL_SIZE.
+*
+* Returns    : The next available TLS 'id' or OS_CFG_TLS_TBL_SIZE if an error is detected.
+************************************************************************************************************************
+*/
+
+OS_TLS_ID  OS_TLS_GetID (OS_ERR  *p_err)
+{
+    OS_TLS_ID  id;
+
+    CPU_SR_ALLOC();
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return ((OS_TLS_ID)OS_CFG_TLS_TBL_SIZE);
+    }
+#endif
+
+#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u
+    if(OSIntNestingCtr > (OS_NESTING_CTR)0)                       /* 检查是否在中断中运行                             */
+    {
+       *p_err = OS_ERR_TLS_ISR;
+        return ((OS_TLS_ID)OS_CFG_TLS_TBL_SIZE);
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    if (OS_TLS_NextAvailID >= OS_CFG_TLS_TBL_SIZE) {              /* See if we exceeded the number of IDs available   */
+       *p_err = OS_ERR_TLS_NO_MORE_AVAIL;                         /* Yes, cannot allocate more TLS                    */
+        CPU_CRITICAL_EXIT();
+        return ((OS_TLS_ID)OS_CFG_TLS_TBL_SIZE);
+    }
+
+    id    = OS_TLS_NextAvailID;                                   /* Assign the next available ID                     */
+    OS_TLS_NextAvailID++;                                         /* Increment available ID for next request          */
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+    return (id);
+}
+
+/*
+************************************************************************************************************************
+*                                                 GET THE CURRENT VALUE OF A TLS
+*
+* Description: This function is called to obtain the current value of a TLS register
+*
+* Arguments  : p_tcb     is a pointer to the OS_TCB of the task you want to read the TLS register from.  If 'p_tcb' is
+*                        a NULL pointer then you will get the TLS register of the current task.
+*
+*              id        is the 'id' of the desired TLS register.  Note that the 'id' must be less than
+*                        'OS_TLS_NextAvailID'
+*
+*              p_err     is a pointer to a variable that will hold an error code related to this call.
+*
+*                            OS_ERR_NONE            if the call was successful
+*                            OS_ERR_TLS_ID_INVALID  if the 'id' is greater or equal to OS_TLS_NextAvailID
+*                            OS_ERR_TLS_NOT_EN      if the task was created by specifying that TLS support was not
+*                                                     needed for the task, or the task is not an OS_TCB
+*
+* Returns    : The current value of the task's TLS register or 0 if an error is detected.
+*
+* Note(s)    : 1) 'p_tcb'为NULL时不进入临界区.
+************************************************************************************************************************
+*/
+
+OS_TLS  OS_TLS_GetValue (OS_TCB     *p_tcb,
+                         OS_TLS_ID   id,
+                         OS_ERR     *p_err)
+{
+    OS_TLS  value;
+
+    CPU_SR_ALLOC();
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return ((OS_TLS)0);
+    }
+#endif
+
+#if OS_CFG_ARG_CHK_EN > 0u
+    if (id >= OS_TLS_NextAvailID) {                               /* Caller must specify an ID that's been assigned   */
+       *p_err = OS_ERR_TLS_ID_INVALID;
+        return ((OS_TLS)0);
+    }
+#endif
+
+    if (p_tcb == (OS_TCB *)0) {                                   /* 当前任务的TLS槽只有任务自身访问                  */
+        p_tcb = OSTCBCurPtr;
+        if (OS_TLS_TaskIsEn(p_tcb) == DEF_FALSE) {
+           *p_err = OS_ERR_TLS_NOT_EN;
+            return ((OS_TLS)0);
+        }
+       *p_err = OS_ERR_NONE;
+        return (p_tcb->TLS_Tbl[id]);
+    }
+
+    CPU_CRITICAL_ENTER();
+    if (OS_TLS_TaskIsEn(p_tcb) == DEF_FALSE) {
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_TLS_NOT_EN;
+        return ((OS_TLS)0);
+    }
+    value = p_tcb->TLS_Tbl[id];
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+    return (value);
+}
+
+/*
+************************************************************************************************************************
+*                                            INITIALIZE THE TASK LOCAL STORAGE SERVICES
+*
+* Description: This function is called by uC/OS-III to initialize the TLS id allocator.
+*
+* Arguments  : p_err     is a pointer to a variable that will hold an error code related to this call.
+*
+*                            OS_ERR_NONE            if the call was successful
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application should not call it.
+************************************************************************************************************************
+*/
+
+void  OS_TLS_Init (OS_ERR  *p_err)
+{
+    OS_TLS_ID  id;
+
+
+    OS_TLS_NextAvailID = (OS_TLS_ID)0;
+    for (id = 0u; id < OS_CFG_TLS_TBL_SIZE; id++) {               /* Don't use any destructors                        */
+        OS_TLS_DestructPtrTbl[id] = (OS_TLS_DESTRUCT_PTR)0;
+    }
+   *p_err = OS_ERR_NONE;
+}
+
+/*
+************************************************************************************************************************
+*                                                  SET THE CURRENT VALUE OF A TLS
+*
+* Description: This function is called to change the current value of a task TLS register.
+*
+* Arguments  : p_tcb     is a pointer to the OS_TCB of the task you want to set the task's TLS register for.  If 'p_tcb'
+*                        is a NULL pointer then you will change the TLS register of the current task.
+*
+*              id        is the 'id' of the desired task TLS register.  Note that the 'id' must be less than
+*                        'OS_TLS_NextAvailID'
+*
+*              value     is the desired value for the task TLS register.
+*
+*              p_err     is a pointer to a variable that will hold an error code related to this call.
+*
+*                            OS_ERR_NONE            if the call was successful
+*                            OS_ERR_TLS_ID_INVALID  if you specified an invalid TLS ID
+*                            OS_ERR_TLS_NOT_EN      if the task was created by specifying that TLS support was not
+*                                                     needed for the task, or the task is not an OS_TCB
+*
+* Returns    : none
+*
+* Note(s)    : 1) 'p_tcb'为NULL时不进入临界区.
+************************************************************************************************************************
+*/
+
+void  OS_TLS_SetValue (OS_TCB     *p_tcb,
+                       OS_TLS_ID   id,
+                       OS_TLS      value,
+                       OS_ERR     *p_err)
+{
+    CPU_SR_ALLOC();
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if OS_CFG_ARG_CHK_EN > 0u
+    if (id >= OS_TLS_NextAvailID) {                               /* Caller must specify an ID that's been assigned   */
+       *p_err = OS_ERR_TLS_ID_INVALID;
+        return;
+    }
+#endif
+
+    if (p_tcb == (OS_TCB *)0) {                                   /* 当前任务的TLS槽只有任务自身访问                  */
+        p_tcb = OSTCBCurPtr;
+        if (OS_TLS_TaskIsEn(p_tcb) == DEF_FALSE) {
+           *p_err = OS_ERR_TLS_NOT_EN;
+            return;
+        }
+        p_tcb->TLS_Tbl[id] = value;
+       *p_err = OS_ERR_NONE;
+        return;
+    }
+
+    CPU_CRITICAL_ENTER();
+    if (OS_TLS_TaskIsEn(p_tcb) == DEF_FALSE) {
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_TLS_NOT_EN;
+        return;
+    }
+    p_tcb->TLS_Tbl[id] = value;
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+
+/*
+************************************************************************************************************************
+*                                             DEFINE TLS DESTRUCTOR FUNCTION
+*
+* Description: This function is called by the user to assign a 'destructor' function to a specific TLS.  When a task is
+*              deleted, all the destructors are called for all the task's TLS for which there is a destructor function
+*              defined.  In other words, when a task is deleted, all the non-NULL functions present in
+*              OS_TLS_DestructPtrTbl[] will be called.
+*
+* Arguments  : id          is the ID of the TLS destructor to set
+*
+*              p_destruct  is a pointer to a function that is associated with a specific TLS register and is called when
+*                          a task is deleted.  The prototype of such functions is:
+*
+*                            void  MyDestructFunction (OS_TCB     *p_tcb,
+*                                                      OS_TLS_ID   id,
+*                                                      OS_TLS      value);
+*
+*                          you can specify a NULL pointer if you don't want to have a function associated with a TLS
+*                          register.  A NULL pointer (i.e. no function associated with a TLS register) is the default
+*                          value placed in OS_TLS_DestructPtrTbl[].
+*
+*              p_err       is a pointer to an error return code.  The possible values are:
+*
+*                            OS_ERR_NONE                  The call was successful.
+*                            OS_ERR_TLS_ID_INVALID        You specified an invalid TLS ID
+*                            OS_ERR_TLS_ISR               if you called this function from an ISR
+*                            OS_ERR_TLS_DESTRUCT_ASSIGNED If a destructor has already been assigned to the TLS ID
+*
+* Returns    : none
+*
+* Note(s)    : 1) 析构函数在调用OSTaskDel()的任务中执行(任务删除自身时即为被删除的任务),不处于临界区内,
+*                 可以释放TLS所指向的内存.
+************************************************************************************************************************
+*/
+
+void  OS_TLS_SetDestruct (OS_TLS_ID            id,
+                          OS_TLS_DESTRUCT_PTR  p_destruct,
+                          OS_ERR              *p_err)
+{
+    CPU_SR_ALLOC();
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u
+    if(OSIntNestingCtr > (OS_NESTING_CTR)0)                       /* 检查是否在中断中运行                             */
+    {
+       *p_err = OS_ERR_TLS_ISR;
+        return;
+    }
+#endif
+
+#if OS_CFG_ARG_CHK_EN > 0u
+    if (id >= OS_TLS_NextAvailID) {                               /* See if we exceeded the number of TLS IDs         */
+       *p_err = OS_ERR_TLS_ID_INVALID;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    if (OS_TLS_DestructPtrTbl[id] != (OS_TLS_DESTRUCT_PTR)0) {    /* Can only assign a destructor once                */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_TLS_DESTRUCT_ASSIGNED;
+        return;
+    }
+    OS_TLS_DestructPtrTbl[id] = p_destruct;
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+
+/*
+************************************************************************************************************************
+*                                                  TASK CREATE HOOK
+*
+* Description: This function is called by OSTaskCreate() after the task's TLS registers have been cleared.
+*
+* Arguments  : p_tcb     is a pointer to the OS_TCB of the task being created.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application should not call it.
+*
+*              2) 原版中由编译器相关的实现在此为C库分配重入结构;本实现的TLS槽已在OSTaskCreate()中清零,无需额外处理.
+************************************************************************************************************************
+*/
+
+void  OS_TLS_TaskCreate (OS_TCB  *p_tcb)
+{
+    CPU_VAL_UNUSED(p_tcb);
+}
+
+/*
+************************************************************************************************************************
+*                                                  TASK DELETE HOOK
+*
+* Description: This function is called by OSTaskDel() to call the destructor of each assigned TLS of the deleted task.
+*
+* Arguments  : p_tcb     is a pointer to the OS_TCB of the task being deleted.
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application should not call it.
+*
+*              2) 该函数在rt_thread_detach()之后调用,被删除的任务不会再运行,因此不需要进入临界区.
+************************************************************************************************************************
+*/
+
+void  OS_TLS_TaskDel (OS_TCB  *p_tcb)
+{
+    OS_TLS_ID            id;
+    OS_TLS_ID            nbr;
+    OS_TLS_DESTRUCT_PTR  p_destruct;
+
+
+    if (OS_TLS_TaskIsEn(p_tcb) == DEF_FALSE) {
+        return;
+    }
+    nbr = OS_TLS_NextAvailID;
+    for (id = 0u; id < nbr; id++) {
+        p_destruct = OS_TLS_DestructPtrTbl[id];
+        if (p_destruct != (OS_TLS_DESTRUCT_PTR)0) {               /* Call destructor if there is one                  */
+            (*p_destruct)(p_tcb, id, p_tcb->TLS_Tbl[id]);
+        }
+        p_tcb->TLS_Tbl[id] = (OS_TLS)0;
+    }
+}
+
+/*
+************************************************************************************************************************
+*                                                  TASK SWITCH HOOK
+*
+* Description: This function is called when a task switch is performed.
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application should not call it.
+*
+*              2) TLS槽位于OS_TCB中,任务切换时无需任何处理,因此本兼容层不在RT-Thread调度器钩子中调用该函数,
+*                 保留该函数仅为与原版接口兼容.
+************************************************************************************************************************
+*/
+
+void  OS_TLS_TaskSw (void)
+{
+
+}
+
+/*
+************************************************************************************************************************
+*                                           CHECK IF A TASK HAS TLS REGISTERS
+*
+* Description: This function determines whether 'p_tcb' points to a task that owns TLS registers.
+*
+* Arguments  : p_tcb     is a pointer to the OS_TCB (or RT-Thread thread) to check
+*
+* Returns    : DEF_TRUE  if the task was created by OSTaskCreate() without OS_OPT_TASK_NO_TLS
+*              DEF_FALSE otherwise
+*
+* Note(s)    : 1) 'p_tcb'可能指向RT-Thread原生线程,其后并没有OS_TCB的其他成员,因此先以struct rt_thread内部的
+*                 OS_TASK_FLAG_OS_TCB标记判断,确认是OS_TCB之后才访问.Opt等成员.
+************************************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  OS_TLS_TaskIsEn (OS_TCB  *p_tcb)
+{
+    if (!OS_TASK_IS_OS_TCB(&p_tcb->Task)) {                 /* RT-Thread原生线程没有TLS槽 (see Note #1)               */
+        return (DEF_FALSE);
+    }
+#ifndef PKG_USING_UCOSIII_WRAPPER_TINY
+    if ((p_tcb->Opt & OS_OPT_TASK_NO_TLS) != (OS_OPT)0) {
+        return (DEF_FALSE);
+    }
+#endif
+    return (DEF_TRUE);
+}
+#endif
@@ -62,16 +62,50 @@
 *                 ・RTT的定时器时钟频率与操作系统ostick频率相同
 *                 ・uCOS-III的定时器时钟由ostick分频得到，分频系数为OS_CFG_TMR_TASK_RATE_HZ
 *                函数内部已经对上述两个操作系统定义的做出了转换
+*              2)以OS_OPT_TMR_HARD选项(或OSTmrCreateHard())创建的硬定时器使用RTT的RT_TIMER_FLAG_HARD_TIMER,
+*                回调函数在时钟中断中执行,适用于对抖动敏感的场合,具体限制见OSTmrCreateHard()的说明
+*              3)以OSTmrSlackSet()设置了松弛(slack)的定时器,实际到期时刻可以比理想到期时刻推迟至多slack,兼容层在该
+*                窗口内优先复用其他定时器已选定的到期节拍,否则选择对齐程度最高的时钟节拍,松弛窗口相互重叠的定时器
+*                因此会在同一节拍到期,由定时器线程一次唤醒处理
 ************************************************************************************************************************
 */
 
 #if OS_CFG_TMR_EN > 0u
+/*
+************************************************************************************************************************
+*                                            LOCAL DEFINES
+************************************************************************************************************************
+*/
+/*是否为硬定时器(回调在时钟中断中执行)*/
+#define  OS_TMR_IS_HARD(p_tmr)      (((p_tmr)->Tmr.parent.flag & RT_TIMER_FLAG_SOFT_TIMER) == 0u)
+/*中断中只允许对硬定时器进行操作*/
+#define  OS_TMR_ISR_DENIED(p_tmr)   ((OSIntNestingCtr > (OS_NESTING_CTR)0) && \
+                                    (((p_tmr) == (OS_TMR *)0) || !OS_TMR_IS_HARD(p_tmr)))
+#if OS_CFG_TMR_SLACK_EN > 0u
+/*记录最近选定的若干个到期节拍,松弛窗口覆盖其中之一的定时器直接复用该节拍*/
+#define  OS_TMR_SLACK_TBL_SIZE      8u
+#endif
+
+/*
+************************************************************************************************************************
+*                                          LOCAL GLOBAL VARIABLES
+************************************************************************************************************************
+*/
+#if OS_CFG_TMR_SLACK_EN > 0u
+static rt_tick_t   OS_TmrSlackTbl[OS_TMR_SLACK_TBL_SIZE];   /* 最近选定的到期节拍                                     */
+static CPU_INT08U  OS_TmrSlackTblIx;                        /* 下一个要覆盖的表项                                     */
+#endif
+
 /*
 ************************************************************************************************************************
 *                                          LOCAL PROTOTYPES
 ************************************************************************************************************************
 */
 static void OS_TmrCallback(void *p_ara);
+static void OS_TmrCallbackCall(OS_TMR *p_tmr, OS_TMR_CALLBACK_PTR p_fnct, void *p_arg);
+#if OS_CFG_TMR_SLACK_EN > 0u
+static rt_tick_t OS_TmrSlackArm(OS_TMR *p_tmr, rt_tick_t interval, CPU_BOOLEAN reload);
+#endif
 
 /*
 ************************************************************************************************************************
@@ -98,6 +132,10 @@ static void OS_TmrCallback(void *p_ara);
 *                                  OS_OPT_TMR_ONE_SHOT       The timer counts down only once
 *                                  OS_OPT_TMR_PERIODIC       The timer counts down and then reloads itself
 *
+*                              Either may be OR'ed with:
+*
+*                                  OS_OPT_TMR_HARD           The callback runs in the tick ISR (see OSTmrCreateHard())
+*
 *              p_callback      Is a pointer to a callback function that will be called when the timer expires.  The
 *                              callback function must be declared as follows:
 *
@@ -137,7 +175,9 @@ void  OSTmrCreate (OS_TMR               *p_tmr,
                    OS_ERR               *p_err)
 {
     rt_uint8_t rt_flag;
+    rt_uint8_t rt_ctx;
     rt_tick_t  time, time2;
+    OS_OPT     mode;
 
     CPU_SR_ALLOC();
 
@@ -163,13 +203,15 @@ void  OSTmrCreate (OS_TMR               *p_tmr,
     }
 #endif
 
+    mode = (OS_OPT)(opt & ~OS_OPT_TMR_HARD);                     /* 去掉HARD位后即为定时器模式                        */
+
 #if OS_CFG_ARG_CHK_EN > 0u
     if(p_tmr == RT_NULL)                                         /* 检查指针是否为空                                  */
     {
         *p_err = OS_ERR_OBJ_PTR_NULL;
         return;
     }
-    switch (opt) {
+    switch (mode) {
         case OS_OPT_TMR_PERIODIC:
              if (period == (OS_TICK)0) {
                 *p_err = OS_ERR_TMR_INVALID_PERIOD;
@@ -205,16 +247,26 @@ void  OSTmrCreate (OS_TMR               *p_tmr,
 
     /*
         uCOS-III原版定时器回调函数就是在定时器线程中调用的,而非在中断中调用,
-        因此要使用RTT的RT_TIMER_FLAG_SOFT_TIMER选项,在此之前应将宏定义RT_USING_TIMER_SOFT置1
+        因此要使用RTT的RT_TIMER_FLAG_SOFT_TIMER选项,在此之前应将宏定义RT_USING_TIMER_SOFT置1;
+        只有指定了OS_OPT_TMR_HARD选项的定时器才使用RT_TIMER_FLAG_HARD_TIMER,在时钟中断中回调
     */
-    if(opt == OS_OPT_TMR_ONE_SHOT)
+    if((opt & OS_OPT_TMR_HARD) != 0u)
+    {
+        rt_ctx = RT_TIMER_FLAG_HARD_TIMER;
+    }
+    else
+    {
+        rt_ctx = RT_TIMER_FLAG_SOFT_TIMER;
+    }
+
+    if(mode == OS_OPT_TMR_ONE_SHOT)
     {
-        rt_flag = RT_TIMER_FLAG_ONE_SHOT|RT_TIMER_FLAG_SOFT_TIMER;
+        rt_flag = RT_TIMER_FLAG_ONE_SHOT|rt_ctx;
         time = dly * (OS_CFG_TICK_RATE_HZ / OS_CFG_TMR_TASK_RATE_HZ);           /* RTT和uCOS-III在定时器时钟源的设计不同,需要进行转换*/
     }
-    else if(opt == OS_OPT_TMR_PERIODIC)
+    else if(mode == OS_OPT_TMR_PERIODIC)
     {
-        rt_flag = RT_TIMER_FLAG_PERIODIC|RT_TIMER_FLAG_SOFT_TIMER;
+        rt_flag = RT_TIMER_FLAG_PERIODIC|rt_ctx;
         time = period * (OS_CFG_TICK_RATE_HZ / OS_CFG_TMR_TASK_RATE_HZ);
     }
     else
@@ -227,12 +279,16 @@ void  OSTmrCreate (OS_TMR               *p_tmr,
     p_tmr->State          = (OS_STATE           )OS_TMR_STATE_STOPPED;     /* Initialize the timer fields             */
     p_tmr->CallbackPtr    = (OS_TMR_CALLBACK_PTR)p_callback;
     p_tmr->CallbackPtrArg = (void              *)p_callback_arg;
-    p_tmr->Opt            = (OS_OPT             )opt;
+    p_tmr->Opt            = (OS_OPT             )mode;
     p_tmr->Period         = (OS_TICK            )period;
     p_tmr->Dly            = (OS_TICK            )dly;
     p_tmr->_dly           = (OS_TICK            )dly;      /* 该变量为兼容层内部使用,用于带有延迟的周期延时           */
     p_tmr->_set_dly       = (OS_TICK            )0;        /* 该变量为兼容层内部使用,用于配合3.08版本中OSTmrSet函数   */
     p_tmr->_set_period    = (OS_TICK            )0;        /* 该变量为兼容层内部使用,用于配合3.08版本中OSTmrSet函数   */
+#if OS_CFG_TMR_SLACK_EN > 0u
+    p_tmr->Slack          = (OS_TICK            )0;        /* 默认不允许推迟到期                                      */
+    p_tmr->_due           = (rt_tick_t          )0;
+#endif
 #ifndef PKG_USING_UCOSIII_WRAPPER_TINY
     p_tmr->Match          = (OS_TICK            )0;
     p_tmr->Remain         = (OS_TICK            )0;
@@ -254,7 +310,7 @@ void  OSTmrCreate (OS_TMR               *p_tmr,
                       OS_TmrCallback,
                       p_tmr,                                /* 将p_tmr作为参数传到回调函数中                          */
                       time2,
-                      RT_TIMER_FLAG_ONE_SHOT|RT_TIMER_FLAG_SOFT_TIMER);
+                      RT_TIMER_FLAG_ONE_SHOT|rt_ctx);
     }
     else
     {
@@ -267,6 +323,7 @@ void  OSTmrCreate (OS_TMR               *p_tmr,
     }
 
     *p_err = OS_ERR_NONE;                                   /* rt_timer_init没有返回错误码                            */
+    OS_TRACE_NAME(p_tmr, p_name);
 
 #ifndef PKG_USING_UCOSIII_WRAPPER_TINY
     CPU_CRITICAL_ENTER();
@@ -278,6 +335,69 @@ void  OSTmrCreate (OS_TMR               *p_tmr,
 #endif
 }
 
+/*
+************************************************************************************************************************
+*                                                CREATE A HARD TIMER
+*
+* Description: This function is called by your application code to create a timer whose callback is executed directly
+*              from the tick ISR instead of from the timer task.  This gives the callback the lowest possible jitter.
+*
+* Arguments  : p_tmr           Is a pointer to a timer control block
+*
+*              p_name          Is a pointer to an ASCII string that is used to name the timer.
+*
+*              dly             Initial delay (see OSTmrCreate()).
+*
+*              period          The 'period' being repeated for the timer (see OSTmrCreate()).
+*
+*              opt             Specifies either:
+*
+*                                  OS_OPT_TMR_ONE_SHOT       The timer counts down only once
+*                                  OS_OPT_TMR_PERIODIC       The timer counts down and then reloads itself
+*
+*              p_callback      Is a pointer to a callback function that will be called from the tick ISR when the
+*                              timer expires.  The callback function must be declared as follows:
+*
+*                                  void  MyHardCallback (OS_TMR *p_tmr, void *p_arg);
+*
+*              p_callback_arg  Is an argument (a pointer) that is passed to the callback function when it is called.
+*
+*              p_err           Is a pointer to an error code.  '*p_err' will contain one of the error codes returned by
+*                              OSTmrCreate().
+*
+* Returns    : none
+*
+* Note(s)    : 1) 本函数等价于以'opt | OS_OPT_TMR_HARD'调用OSTmrCreate(),但回调函数的类型为OS_TMR_HARD_CALLBACK_PTR,
+*                 以便在编译期就区分两种不同执行上下文的回调函数
+*              2) 硬定时器的回调函数在时钟中断中执行,因此:
+*                 ・不能调用任何会阻塞的函数,只能调用允许在中断中调用的函数(如OSSemPost()、OSQPost()、
+*                   OSFlagPost()、OSTaskSemPost()、OSTaskQPost()等)
+*                 ・回调期间调度器不会被锁定,回调函数应尽可能短小
+*              3) 在中断中(包括硬定时器的回调函数中)只允许对硬定时器调用OSTmrStart()、OSTmrStateGet()、
+*                 OSTmrRemainGet()以及以OS_OPT_TMR_NONE选项调用OSTmrStop();OSTmrCreate()、OSTmrDel()仍只能在任务中调用
+*              4) 硬定时器不支持OSTmrSet(),如需修改参数请删除后重新创建
+************************************************************************************************************************
+*/
+
+void  OSTmrCreateHard (OS_TMR                    *p_tmr,
+                       CPU_CHAR                  *p_name,
+                       OS_TICK                    dly,
+                       OS_TICK                    period,
+                       OS_OPT                     opt,
+                       OS_TMR_HARD_CALLBACK_PTR   p_callback,
+                       void                      *p_callback_arg,
+                       OS_ERR                    *p_err)
+{
+    OSTmrCreate(p_tmr,                                      /* 回调函数指针统一保存在CallbackPtr中,回调时再还原类型   */
+                p_name,
+                dly,
+                period,
+                (OS_OPT)(opt | OS_OPT_TMR_HARD),
+                (OS_TMR_CALLBACK_PTR)p_callback,
+                p_callback_arg,
+                p_err);
+}
+
 /*
 ************************************************************************************************************************
 *                                                   DELETE A TIMER
@@ -434,7 +554,7 @@ OS_TICK  OSTmrRemainGet (OS_TMR  *p_tmr,
 #endif
 
 #if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u
-    if(OSIntNestingCtr > (OS_NESTING_CTR)0)                     /* 检查是否在中断中运行                                 */
+    if(OS_TMR_ISR_DENIED(p_tmr))                                /* 中断中只允许对硬定时器调用                           */
     {
         *p_err = OS_ERR_TMR_ISR;
         return 0;
@@ -535,7 +655,7 @@ OS_TICK  OSTmrRemainGet (OS_TMR  *p_tmr,
 *                                 OS_ERR_NONE                    The timer was configured as expected
 *                                 OS_ERR_OBJ_TYPE                If the object type is invalid
 *                                 OS_ERR_OS_NOT_RUNNING          If uC/OS-III is not running yet
-*                                 OS_ERR_TMR_INVALID             If 'p_tmr' is a NULL pointer or invalid option
+*                                 OS_ERR_TMR_INVALID             If 'p_tmr' is NULL, a hard timer or invalid option
 *                                 OS_ERR_TMR_INVALID_CALLBACK    you specified an invalid callback for a periodic timer
 *                                 OS_ERR_TMR_INVALID_DLY         You specified an invalid delay
 *                                 OS_ERR_TMR_INVALID_PERIOD      You specified an invalid period
@@ -546,6 +666,9 @@ OS_TICK  OSTmrRemainGet (OS_TMR  *p_tmr,
 * Note(s)    : 1) This function can be called on a running timer. The change to the delay and period will only
 *                 take effect after the current period or delay has passed. Change to the callback will take
 *                 effect immediately.
+*
+*              2) 新的延时/周期是在定时器回调时由定时器任务重新创建定时器实现的,硬定时器的回调位于中断中,无法这样处理,
+*                 因此不支持硬定时器.
 ************************************************************************************************************************
 */
 
@@ -594,6 +717,11 @@ void  OSTmrSet (OS_TMR               *p_tmr,
     }
 #endif
 
+    if (OS_TMR_IS_HARD(p_tmr)) {                                /* 硬定时器不支持本函数                                 */
+       *p_err = OS_ERR_TMR_INVALID;
+        return;
+    }
+
 #if (OS_CFG_ARG_CHK_EN > 0u)
     switch (p_tmr->Opt) {
         case OS_OPT_TMR_PERIODIC:
@@ -632,6 +760,89 @@ void  OSTmrSet (OS_TMR               *p_tmr,
 }
 
 
+/*
+************************************************************************************************************************
+*                                               SET THE SLACK OF A TIMER
+*
+* Description: This function is called by your application code to specify how late a timer is allowed to expire.
+*              Timers whose slack windows overlap are made to expire on the same tick so that the timer task is woken
+*              up only once for all of them.
+*
+* Arguments  : p_tmr    Is a pointer to the timer
+*
+*              slack    Is the maximum amount of time (in timer ticks, see OS_CFG_TMR_TASK_RATE_HZ) the timer may expire
+*                       after its nominal expiry.  0 means the timer always expires exactly on time.
+*
+*              p_err    Is a pointer to an error code.  '*p_err' will contain one of the following:
+*
+*                           OS_ERR_NONE
+*                           OS_ERR_OBJ_TYPE            if 'p_tmr' is not pointing to a timer
+*                           OS_ERR_OS_NOT_RUNNING      If uC/OS-III is not running yet
+*                           OS_ERR_TMR_INVALID         'p_tmr' is a NULL pointer
+*                           OS_ERR_TMR_ISR             if the call was made from an ISR
+*
+* Returns    : none
+*
+* Note(s)    : 1) 新的松弛在定时器下一次装填时生效,即调用OSTmrStart()时或周期定时器下一次重新装填时.
+*
+*              2) 周期定时器按照未加松弛的理想到期时刻累加周期,松弛只会让单次到期推迟,不会使周期产生累积漂移.
+*
+*              3) 松弛适合大量对到期时刻不敏感的周期性事务(如100ms~10s的后台维护定时器),可以用
+*                 OSTmrWakeupCtr与OSTmrExpireCtr的比值衡量合并的效果.
+************************************************************************************************************************
+*/
+
+#if OS_CFG_TMR_SLACK_EN > 0u
+void  OSTmrSlackSet (OS_TMR   *p_tmr,
+                     OS_TICK   slack,
+                     OS_ERR   *p_err)
+{
+    CPU_SR_ALLOC();
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u)
+    if (OSIntNestingCtr > 0u) {                                 /* See if trying to call from an ISR                    */
+       *p_err = OS_ERR_TMR_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
+    if (OSRunning != OS_STATE_OS_RUNNING) {                     /* Is the kernel running?                               */
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN > 0u)
+    if (p_tmr == (OS_TMR *)0) {                                 /* Validate 'p_tmr'                                     */
+       *p_err = OS_ERR_TMR_INVALID;
+        return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN > 0u)
+    if(rt_object_get_type(&p_tmr->Tmr.parent) != RT_Object_Class_Timer)
+    {
+        *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    p_tmr->Slack = slack;
+    CPU_CRITICAL_EXIT();
+
+   *p_err        = OS_ERR_NONE;
+}
+#endif
+
 /*
 ************************************************************************************************************************
 *                                                   START A TIMER
@@ -660,6 +871,9 @@ CPU_BOOLEAN  OSTmrStart (OS_TMR  *p_tmr,
                          OS_ERR  *p_err)
 {
     rt_err_t rt_err;
+#if OS_CFG_TMR_SLACK_EN > 0u
+    rt_tick_t time;
+#endif
 
     CPU_SR_ALLOC();
 
@@ -671,7 +885,7 @@ CPU_BOOLEAN  OSTmrStart (OS_TMR  *p_tmr,
 #endif
 
 #if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u
-    if(OSIntNestingCtr > (OS_NESTING_CTR)0)                     /* 检查是否在中断中运行                                   */
+    if(OS_TMR_ISR_DENIED(p_tmr))                                /* 中断中只允许对硬定时器调用                             */
     {
         *p_err = OS_ERR_TMR_ISR;
         return DEF_FALSE;
@@ -716,6 +930,22 @@ CPU_BOOLEAN  OSTmrStart (OS_TMR  *p_tmr,
             return (DEF_FALSE);
     }
 
+#if OS_CFG_TMR_SLACK_EN > 0u
+    if(p_tmr->Opt == OS_OPT_TMR_PERIODIC && p_tmr->_dly == 0u)  /* init_tick可能已被松弛修改过,每次启动都重新计算       */
+    {
+        time = p_tmr->Period * (OS_CFG_TICK_RATE_HZ / OS_CFG_TMR_TASK_RATE_HZ);
+    }
+    else
+    {
+        time = p_tmr->Dly * (OS_CFG_TICK_RATE_HZ / OS_CFG_TMR_TASK_RATE_HZ);
+    }
+    if(p_tmr->Slack > 0u)                                       /* 在松弛窗口内选择到期时刻 (see Note #3 at file head)    */
+    {
+        time = OS_TmrSlackArm(p_tmr, time, DEF_FALSE);
+    }
+    rt_timer_control(&p_tmr->Tmr, RT_TIMER_CTRL_SET_TIME, &time);
+#endif
+
     rt_err = rt_timer_start(&p_tmr->Tmr);
     *p_err = rt_err_to_ucosiii(rt_err);
     if(rt_err == RT_EOK)
@@ -781,7 +1011,7 @@ OS_STATE  OSTmrStateGet (OS_TMR  *p_tmr,
 #endif
 
 #if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u
-    if (OSIntNestingCtr > (OS_NESTING_CTR)0) {                  /* See if trying to call from an ISR                     */
+    if (OS_TMR_ISR_DENIED(p_tmr)) {                             /* 中断中只允许对硬定时器调用                            */
        *p_err = OS_ERR_TMR_ISR;
         return (OS_TMR_STATE_UNUSED);
     }
@@ -872,6 +1102,7 @@ CPU_BOOLEAN  OSTmrStop (OS_TMR  *p_tmr,
     rt_err_t rt_err;
     OS_TMR_CALLBACK_PTR  p_fnct;
     OS_ERR err;
+    CPU_BOOLEAN sched_lock;
 
     CPU_SR_ALLOC();
 
@@ -883,11 +1114,16 @@ CPU_BOOLEAN  OSTmrStop (OS_TMR  *p_tmr,
 #endif
 
 #if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u
-    if(OSIntNestingCtr > (OS_NESTING_CTR)0)                     /* 检查是否在中断中运行                                 */
+    if(OS_TMR_ISR_DENIED(p_tmr))                                /* 中断中只允许对硬定时器调用                           */
     {
         *p_err = OS_ERR_TMR_ISR;
         return DEF_FALSE;
     }
+    if((OSIntNestingCtr > (OS_NESTING_CTR)0) && (opt != OS_OPT_TMR_NONE))
+    {
+        *p_err = OS_ERR_OPT_INVALID;                            /* 中断中不允许在停止时执行回调函数                     */
+        return DEF_FALSE;
+    }
 #endif
 
 #if (OS_CFG_INVALID_OS_CALLS_CHK_EN > 0u)
@@ -948,12 +1184,21 @@ CPU_BOOLEAN  OSTmrStop (OS_TMR  *p_tmr,
 
 
     *p_err = OS_ERR_NONE;
-    OSSchedLock(&err);
+    sched_lock = (CPU_BOOLEAN)(OSIntNestingCtr == (OS_NESTING_CTR)0);
+    if(sched_lock == DEF_TRUE)                                  /* 中断中不能锁调度器,也不记录锁定时间的归属            */
+    {
+        OSSchedLock(&err);
+#if OS_CFG_SCHED_LOCK_TIME_MEAS_EN > 0u
+        /*调度器锁定时间归属于该定时器*/
+        OS_SchedLockOwnerSet((const CPU_CHAR *)p_tmr->Tmr.parent.name);
+#endif
+    }
     switch (opt)
     {
         case OS_OPT_TMR_CALLBACK:
             if (p_fnct != (OS_TMR_CALLBACK_PTR)0) {             /* ... if available                                     */
-                (*p_fnct)((void *)p_tmr, p_tmr->CallbackPtrArg);/* Use callback arg when timer was created              */
+                                                                /* Use callback arg when timer was created              */
+                OS_TmrCallbackCall(p_tmr, p_fnct, p_tmr->CallbackPtrArg);
             } else {
                 *p_err = OS_ERR_TMR_NO_CALLBACK;
             }
@@ -961,7 +1206,8 @@ CPU_BOOLEAN  OSTmrStop (OS_TMR  *p_tmr,
 
         case OS_OPT_TMR_CALLBACK_ARG:
               if (p_fnct != (OS_TMR_CALLBACK_PTR)0) {
-                (*p_fnct)((void *)p_tmr, p_callback_arg);       /* .. using the 'callback_arg' provided in call         */
+                                                                /* .. using the 'callback_arg' provided in call         */
+                OS_TmrCallbackCall(p_tmr, p_fnct, p_callback_arg);
               } else {
                  *p_err = OS_ERR_TMR_NO_CALLBACK;
               }
@@ -971,11 +1217,16 @@ CPU_BOOLEAN  OSTmrStop (OS_TMR  *p_tmr,
             break;
 
          default:
-             OSSchedUnlock(&err);
+             if (sched_lock == DEF_TRUE) {
+                 OSSchedUnlock(&err);
+             }
             *p_err = OS_ERR_OPT_INVALID;
              return (DEF_FALSE);
     }
-    OSSchedUnlock(&err);
+    if(sched_lock == DEF_TRUE)
+    {
+        OSSchedUnlock(&err);
+    }
 
     if(*p_err != OS_ERR_NONE)
     {
@@ -1067,6 +1318,12 @@ void  OS_TmrDbgListRemove (OS_TMR  *p_tmr)
     p_tmr_prev = p_tmr->DbgPrevPtr;
     p_tmr_next = p_tmr->DbgNextPtr;
 
+#if OS_CFG_STAT_TASK_EN > 0u
+    if (OSStatTaskTmrCursorPtr == p_tmr) {                  /* 统计任务的遍历游标跳过被删除的定时器                   */
+        OSStatTaskTmrCursorPtr = p_tmr_next;
+    }
+#endif
+
     if (p_tmr_prev == (OS_TMR *)0) {
         OSTmrDbgListPtr = p_tmr_next;
         if (p_tmr_next != (OS_TMR *)0) {
@@ -1111,6 +1368,9 @@ void  OS_TmrInit (OS_ERR  *p_err)
 {
 #ifndef PKG_USING_UCOSIII_WRAPPER_TINY
     OSTmrQty        = (OS_OBJ_QTY)0;
+    OSTmrExpireCtr  = (OS_CTR    )0;
+    OSTmrWakeupCtr  = (OS_CTR    )0;
+    OSTmrWakeupTick = (rt_tick_t )0;
 #if OS_CFG_DBG_EN > 0u
     OSTmrDbgListPtr = (OS_TMR   *)0;
 #endif
@@ -1135,25 +1395,49 @@ static void OS_TmrCallback(void *p_ara)
     OS_OPT opt;
     OS_TICK dly;
     OS_TICK period;
+#if OS_CFG_TMR_SLACK_EN > 0u
+    OS_TICK slack;
+#endif
+    CPU_BOOLEAN sched_lock;
 
     CPU_SR_ALLOC();
 
     p_tmr = (OS_TMR*)p_ara;
 
 #if OS_CFG_CALLED_FROM_ISR_CHK_EN > 0u
-    if(OSIntNestingCtr > (OS_NESTING_CTR)0)                 /* 检查是否在中断中运行                                 */
+    if(OS_TMR_ISR_DENIED(p_tmr))                            /* 软定时器的回调不可以在中断中运行                     */
     {
         RT_DEBUG_LOG(OS_CFG_DBG_EN,("uCOS-III的定时器是在任务中运行的,不可以在RTT的Hard模式下运行\n"));
         return;
     }
 #endif
 
+#ifndef PKG_USING_UCOSIII_WRAPPER_TINY
+    if(!OS_TMR_IS_HARD(p_tmr))                              /* 硬定时器在时钟中断中执行,不会唤醒定时器线程          */
+    {
+        CPU_CRITICAL_ENTER();
+        OSTmrExpireCtr++;
+        if(OSTmrWakeupCtr == (OS_CTR)0 || OSTmrWakeupTick != rt_tick_get())
+        {
+            OSTmrWakeupTick = rt_tick_get();                /* 同一时钟节拍内到期的定时器只算一次唤醒               */
+            OSTmrWakeupCtr++;
+        }
+        CPU_CRITICAL_EXIT();
+    }
+#endif
+
     if(p_tmr->Opt==OS_OPT_TMR_PERIODIC && p_tmr->_dly && p_tmr->Period)
     {
         /*带有延迟的周期延时，延迟延时已经完毕，开始进行正常周期延时*/
         CPU_CRITICAL_ENTER();
         p_tmr->_dly = 0;                                    /* 延迟部分清零，防止再进入本条件分支语句               */
         p_tmr->Tmr.init_tick = p_tmr->Period * (OS_CFG_TICK_RATE_HZ / OS_CFG_TMR_TASK_RATE_HZ);
+#if OS_CFG_TMR_SLACK_EN > 0u
+        if(p_tmr->Slack > 0u)
+        {
+            p_tmr->Tmr.init_tick = OS_TmrSlackArm(p_tmr, p_tmr->Tmr.init_tick, DEF_TRUE);
+        }
+#endif
         p_tmr->Tmr.timeout_tick = rt_tick_get() + p_tmr->Tmr.init_tick;
         p_tmr->Tmr.parent.flag |= RT_TIMER_FLAG_PERIODIC;   /* 定时器设置为周期模式                                 */
 #ifndef PKG_USING_UCOSIII_WRAPPER_TINY
@@ -1174,6 +1458,16 @@ static void OS_TmrCallback(void *p_ara)
     }
     else if(p_tmr->Opt == OS_OPT_TMR_PERIODIC)
     {
+#if OS_CFG_TMR_SLACK_EN > 0u
+        /*RTT在回调返回后以init_tick重新装填周期定时器,在此之前换成落在松弛窗口内的延时*/
+        CPU_CRITICAL_ENTER();
+        p_tmr->Tmr.init_tick = p_tmr->Period * (OS_CFG_TICK_RATE_HZ / OS_CFG_TMR_TASK_RATE_HZ);
+        if(p_tmr->Slack > 0u)
+        {
+            p_tmr->Tmr.init_tick = OS_TmrSlackArm(p_tmr, p_tmr->Tmr.init_tick, DEF_TRUE);
+        }
+        CPU_CRITICAL_EXIT();
+#endif
 #ifndef PKG_USING_UCOSIII_WRAPPER_TINY
         CPU_CRITICAL_ENTER();
         p_tmr->Match = rt_tick_get() + p_tmr->Tmr.init_tick;
@@ -1182,10 +1476,33 @@ static void OS_TmrCallback(void *p_ara)
 #endif
     }
 
-    /*调用真正uCOS-III的软件定时器回调函数*/
-    OSSchedLock(&err);
+    OS_TRACE(OS_TRACE_EV_TMR_EXPIRE, p_tmr, 0u);
+
+    if(OS_TMR_IS_HARD(p_tmr))
+    {
+        /*硬定时器已处于时钟中断中,直接调用回调函数,不锁调度器,也不处理OSTmrSet函数的设置*/
+        if(p_tmr->CallbackPtr != (OS_TMR_CALLBACK_PTR)0)
+        {
+            OS_TmrCallbackCall(p_tmr, p_tmr->CallbackPtr, p_tmr->CallbackPtrArg);
+        }
+        return;
+    }
+
+    /*调用真正uCOS-III的软件定时器回调函数,未开启RT_USING_TIMER_SOFT时在中断中执行,此时不锁调度器*/
+    sched_lock = (CPU_BOOLEAN)(OSIntNestingCtr == (OS_NESTING_CTR)0);
+    if(sched_lock == DEF_TRUE)
+    {
+        OSSchedLock(&err);
+#if OS_CFG_SCHED_LOCK_TIME_MEAS_EN > 0u
+        /*调度器锁定时间归属于该定时器*/
+        OS_SchedLockOwnerSet((const CPU_CHAR *)p_tmr->Tmr.parent.name);
+#endif
+    }
     p_tmr->CallbackPtr((void *)p_tmr, p_tmr->CallbackPtrArg);
-    OSSchedUnlock(&err);
+    if(sched_lock == DEF_TRUE)
+    {
+        OSSchedUnlock(&err);
+    }
 
     /*开始处理OSTmrSet函数的设置*/
     if(p_tmr->_set_dly || p_tmr->_set_period)               /* 检查是否调用OSTmrSet函数                             */
@@ -1196,12 +1513,115 @@ static void OS_TmrCallback(void *p_ara)
         opt = p_tmr->Opt;
         dly = p_tmr->_set_dly;
         period = p_tmr->_set_period;
+#if OS_CFG_TMR_SLACK_EN > 0u
+        slack = p_tmr->Slack;
+#endif
 
         OSTmrDel(p_tmr,&err);                               /* 删除老定时器,_set_dly/_set_period会在此函数中清零    */
         OSTmrCreate(p_tmr, p_tmr->Tmr.parent.name,          /* 创建新定时器,并装填新的参数                          */
             dly, period, opt, callback, arg, &err);
+#if OS_CFG_TMR_SLACK_EN > 0u
+        p_tmr->Slack = slack;                               /* 重新创建不改变定时器的松弛                           */
+#endif
         OSTmrStart(p_tmr, &err);                            /* 启动装填新参数的定时器                               */
     }
 }
 
+/*
+************************************************************************************************************************
+*                                                 调用用户回调函数
+*
+* Description: 根据定时器的类型按正确的函数原型调用用户的回调函数:硬定时器为OS_TMR_HARD_CALLBACK_PTR,
+*              其他定时器为OS_TMR_CALLBACK_PTR.
+************************************************************************************************************************
+*/
+static void OS_TmrCallbackCall(OS_TMR *p_tmr, OS_TMR_CALLBACK_PTR p_fnct, void *p_arg)
+{
+    if(OS_TMR_IS_HARD(p_tmr))
+    {
+        ((OS_TMR_HARD_CALLBACK_PTR)p_fnct)(p_tmr, p_arg);
+    }
+    else
+    {
+        p_fnct((void *)p_tmr, p_arg);
+    }
+}
+
+#if OS_CFG_TMR_SLACK_EN > 0u
+/*
+************************************************************************************************************************
+*                                                 计算带松弛的到期时刻
+*
+* Description: 计算定时器下一次的理想到期时刻due,并在窗口[due, due + 松弛]内选择实际到期时刻:
+*                  1) 如果最近选定过的某个到期节拍落在窗口内,直接复用该节拍,与对应的定时器在同一次唤醒中处理;
+*                  2) 否则选取窗口内二进制末尾0最多的时钟节拍.所有定时器都按同一规则对齐,窗口相互重叠的定时器
+*                     大多会落到同一个时钟节拍上,该节拍随后被记录下来供其他定时器复用.
+*
+* Arguments  : p_tmr      是指向定时器的指针
+*
+*              interval   到下一次理想到期时刻的间隔(RTT时钟节拍)
+*
+*              reload     DEF_TRUE表示周期定时器重新装填,下一次理想到期时刻在上一次理想到期时刻的基础上累加;
+*                         DEF_FALSE表示从当前时刻开始计算
+*
+* Returns    : 实际到期时刻距当前时刻的时钟节拍数,可直接作为RTT定时器的init_tick
+*
+* Note(s)    : 1) 调用者需要保证p_tmr->Slack不为0.
+************************************************************************************************************************
+*/
+static rt_tick_t OS_TmrSlackArm(OS_TMR *p_tmr, rt_tick_t interval, CPU_BOOLEAN reload)
+{
+    rt_tick_t   now;
+    rt_tick_t   due;
+    rt_tick_t   slack;
+    rt_tick_t   mask;
+    rt_tick_t   tick;
+    CPU_INT08U  i;
+    CPU_BOOLEAN found;
+
+    CPU_SR_ALLOC();
+
+    slack = p_tmr->Slack * (OS_CFG_TICK_RATE_HZ / OS_CFG_TMR_TASK_RATE_HZ);
+
+    CPU_CRITICAL_ENTER();
+    now = rt_tick_get();
+    due = p_tmr->_due + interval;                           /* 理想到期时刻按周期累加,不随松弛漂移                  */
+    if(reload == DEF_FALSE || (rt_tick_t)(due - now - 1u) >= RT_TICK_MAX / 2u)
+    {
+        due = now + interval;                               /* 首次装填,或已经错过了理想到期时刻                    */
+    }
+    p_tmr->_due = due;
+
+    found = DEF_FALSE;
+    tick  = due + slack;
+    for(i = 0u; i < OS_TMR_SLACK_TBL_SIZE; i++)             /* 在窗口内找最早的、已被其他定时器选定的到期节拍       */
+    {
+        if((rt_tick_t)(OS_TmrSlackTbl[i] - due) <= slack &&
+           (rt_tick_t)(OS_TmrSlackTbl[i] - due) <= (rt_tick_t)(tick - due))
+        {
+            tick  = OS_TmrSlackTbl[i];
+            found = DEF_TRUE;
+        }
+    }
+
+    if(found == DEF_FALSE)
+    {
+        mask = due ^ tick;                                  /* tick此时为窗口的上限                                 */
+        if(mask != 0u)
+        {
+            while((mask & (mask - 1u)) != 0u)               /* 只保留两者不同的最高位                               */
+            {
+                mask &= mask - 1u;
+            }
+            tick &= ~(mask - 1u);                           /* 窗口内末尾0最多的时钟节拍                            */
+        }
+        OS_TmrSlackTbl[OS_TmrSlackTblIx] = tick;            /* 记录下来,供窗口重叠的定时器复用                      */
+        OS_TmrSlackTblIx = (CPU_INT08U)((OS_TmrSlackTblIx + 1u) % OS_TMR_SLACK_TBL_SIZE);
+    }
+    CPU_CRITICAL_EXIT();
+
+    return (tick - now);
+}
+#endif
+
 #endif
@@ -0,0 +1,265 @@
+/*
+ * Copyright (c) 2021, Meco Jianting Man <jiantingman@foxmail.com>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Change Logs:
+ * Date           Author       Notes
+ * 2026-10-19     agent        implement binary kernel event trace recorder
+ */
+/*
+************************************************************************************************************************
+*                                                      uC/OS-III
+*                                                 The Real-Time Kernel
+*
+*                                                   TRACE RECORDER
+*
+* File    : OS_TRACE.C
+* Version : V3.03.00
+************************************************************************************************************************
+* Note(s)    : 1) 内核事件以固定长度的二进制记录(OS_TRACE_REC)写入OSCfg_TraceBuf[]环形缓冲区,缓冲区满后覆盖最旧的记录.
+*                 记录点包括:任务切换(RT-Thread调度器钩子)、中断进入/退出、信号量/互斥量/消息队列/事件标志组的
+*                 发布与等待、延时以及定时器到期.
+*
+*              2) OS_CFG_TRACE_EN为0时,OS_TRACE()/OS_TRACE_NAME()被定义为空,不生成任何代码.
+*
+*              3) 缓冲区可以通过msh命令'ucos -trace'以文本形式导出,也可以由调试器直接转储OSCfg_TraceBuf[],
+*                 再由tools/os_trace2json.py转换为Chrome/Perfetto可以打开的JSON文件.
+************************************************************************************************************************
+*/
+
+#include "os.h"
+
+#if OS_CFG_TRACE_EN > 0u
+static  void  OS_TraceWr (CPU_INT16U   event,
+                          CPU_INT32U   task,
+                          CPU_INT32U   obj,
+                          CPU_INT32U   arg);
+
+/*
+************************************************************************************************************************
+*                                                 CLEAR THE TRACE BUFFER
+*
+* Description: This function discards all the records in the trace buffer.
+*
+* Arguments  : none
+*
+* Returns    : none
+************************************************************************************************************************
+*/
+
+void  OSTraceClr (void)
+{
+    OS_TRACE_REC  *p_rec;
+    CPU_INT32U     i;
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    p_rec = &OSCfg_TraceBuf[0];
+    for (i = 0u; i < OS_CFG_TRACE_BUF_SIZE; i++) {
+        p_rec->TS      = (CPU_TS32  )0u;
+        p_rec->Event   = (CPU_INT16U)OS_TRACE_EV_NONE;
+        p_rec->IntNest = (CPU_INT16U)0u;
+        p_rec->Task    = (CPU_INT32U)0u;
+        p_rec->Obj     = (CPU_INT32U)0u;
+        p_rec->Arg     = (CPU_INT32U)0u;
+        p_rec++;
+    }
+    OSTraceIx  = 0u;
+    OSTraceCtr = 0u;
+    CPU_CRITICAL_EXIT();
+}
+
+/*
+************************************************************************************************************************
+*                                               ENABLE/DISABLE TRACE RECORDING
+*
+* Description: This function starts or stops writing records to the trace buffer.  The buffer content is kept.
+*
+* Arguments  : en        DEF_ENABLED  to start recording
+*                        DEF_DISABLED to stop  recording
+*
+* Returns    : none
+*
+* Note(s)    : 1) 导出缓冲区之前应先停止记录,以免导出过程中记录被覆盖.
+************************************************************************************************************************
+*/
+
+void  OSTraceEnable (CPU_BOOLEAN  en)
+{
+    OSTraceEn = en;
+}
+
+/*
+************************************************************************************************************************
+*                                             INITIALIZE THE TRACE RECORDER
+*
+* Description: This function is called by OSInit() to initialize the trace recorder.
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+void  OS_TraceInit (void)
+{
+    OSTraceClr();
+    OSTraceEn = DEF_ENABLED;
+}
+
+/*
+************************************************************************************************************************
+*                                                 RECORD AN OBJECT NAME
+*
+* Description: This function writes an OS_TRACE_EV_NAME record so that the host decoder can show names instead of
+*              addresses.  It is called when a task or a kernel object is created.
+*
+* Arguments  : p_obj     is a pointer to the object
+*
+*              p_name    is the name of the object (only the first 8 characters are recorded)
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+void  OS_TraceName (void            *p_obj,
+                    const CPU_CHAR  *p_name)
+{
+    CPU_INT08U  name[8];
+    CPU_INT08U  i;
+
+
+    for (i = 0u; i < sizeof(name); i++) {                   /* 不足8个字符时以0填充                                   */
+        if ((p_name != (const CPU_CHAR *)0) && (*p_name != (CPU_CHAR)0)) {
+            name[i] = (CPU_INT08U)*p_name++;
+        } else {
+            name[i] = 0u;
+        }
+    }
+    OS_TraceWr(OS_TRACE_EV_NAME,                            /* Task = 前4个字符, Arg = 后4个字符 (小端)               */
+              (CPU_INT32U)name[0]         | ((CPU_INT32U)name[1] <<  8u) |
+             ((CPU_INT32U)name[2] << 16u) | ((CPU_INT32U)name[3] << 24u),
+              (CPU_INT32U)(CPU_ADDR)p_obj,
+              (CPU_INT32U)name[4]         | ((CPU_INT32U)name[5] <<  8u) |
+             ((CPU_INT32U)name[6] << 16u) | ((CPU_INT32U)name[7] << 24u));
+}
+
+/*
+************************************************************************************************************************
+*                                                   WRITE A TRACE RECORD
+*
+* Description: This function writes one record into the trace ring buffer.  It is called through the OS_TRACE() macro
+*              from the API entry/exit points and from OSTaskSwHook().
+*
+* Arguments  : event     is the event ID (see OS_TRACE_EV_xxx)
+*
+*              p_obj     is a pointer to the kernel object involved (or the task switched in)
+*
+*              arg       is an event specific argument
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) 可以在任务、中断以及调度器钩子(关中断)中调用.
+*
+*              3) 开启中断延迟发布时,中断中的发布先记录一次,中断处理任务重新发布时还会再记录一次.后者的事件ID带有
+*                 OS_TRACE_EV_REPOST标志位,解码工具据此将其与中断中的发布记录对应起来,而不是当作一次新的发布.
+************************************************************************************************************************
+*/
+
+void  OS_TraceRec (CPU_INT16U   event,
+                   void        *p_obj,
+                   CPU_INT32U   arg)
+{
+#if OS_CFG_ISR_POST_DEFERRED_EN > 0u
+    if (rt_thread_self() == &OSIntQTaskTCB.Task) {          /* See Note #3                                            */
+        event |= OS_TRACE_EV_REPOST;
+    }
+#endif
+    OS_TraceWr(event,
+               (CPU_INT32U)(CPU_ADDR)rt_thread_self(),
+               (CPU_INT32U)(CPU_ADDR)p_obj,
+               arg);
+}
+
+/*
+************************************************************************************************************************
+*                                                RECORD A TASK SWITCH
+*
+* Description: This function is called by OSTaskSwHook() to record a task switch.
+*
+* Arguments  : from      is the thread being switched out
+*
+*              to        is the thread being switched in
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) 调度器钩子被调用时rt_thread_self()已经指向被切入的线程,因此需要显式记录被切出的线程.
+************************************************************************************************************************
+*/
+
+void  OS_TraceTaskSw (rt_thread_t  from,
+                      rt_thread_t  to)
+{
+    OS_TraceWr(OS_TRACE_EV_TASK_SW,
+               (CPU_INT32U)(CPU_ADDR)from,
+               (CPU_INT32U)(CPU_ADDR)to,
+               (CPU_INT32U)0u);
+}
+
+/*
+************************************************************************************************************************
+*                                              WRITE A RECORD INTO THE RING
+*
+* Description: This function writes one record into OSCfg_TraceBuf[] and advances the write index.
+*
+* Arguments  : event     is the event ID
+*
+*              task      is the value of the Task field
+*
+*              obj       is the value of the Obj  field
+*
+*              arg       is the value of the Arg  field
+*
+* Returns    : none
+************************************************************************************************************************
+*/
+
+static  void  OS_TraceWr (CPU_INT16U   event,
+                          CPU_INT32U   task,
+                          CPU_INT32U   obj,
+                          CPU_INT32U   arg)
+{
+    OS_TRACE_REC  *p_rec;
+    CPU_SR_ALLOC();
+
+
+    if (OSTraceEn != DEF_ENABLED) {
+        return;
+    }
+
+    CPU_CRITICAL_ENTER();
+    p_rec = &OSCfg_TraceBuf[OSTraceIx];
+    OSTraceIx++;
+    if (OSTraceIx >= OS_CFG_TRACE_BUF_SIZE) {               /* 环形缓冲区,覆盖最旧的记录                              */
+        OSTraceIx = 0u;
+    }
+    OSTraceCtr++;
+    p_rec->TS      = (CPU_TS32  )OS_TS_GET();
+    p_rec->Event   = (CPU_INT16U)event;
+    p_rec->IntNest = (CPU_INT16U)OSIntNestingCtr;
+    p_rec->Task    = task;
+    p_rec->Obj     = obj;
+    p_rec->Arg     = arg;
+    CPU_CRITICAL_EXIT();
+}
+#endif
@@ -89,6 +89,8 @@ typedef   CPU_INT16U      OS_MSG_SIZE;                 /* Size of messages in nu
 
 typedef   CPU_INT08U      OS_NESTING_CTR;              /* Interrupt and scheduler nesting,                  <8>/16/32 */
 
+typedef   CPU_INT32U      OS_NOTIFY_VAL;               /* Task notification value,                                 32 */
+
 typedef   CPU_INT16U      OS_OBJ_QTY;                  /* Number of kernel objects counter,                   <16>/32 */
 typedef   CPU_INT32U      OS_OBJ_TYPE;                 /* Special flag to determine object type,                   32 */
 